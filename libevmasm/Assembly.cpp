@@ -29,12 +29,21 @@
 #include <libevmasm/BlockDeduplicator.h>
 #include <libevmasm/ConstantOptimiser.h>
 #include <libevmasm/GasMeter.h>
+#include <libevmasm/SemanticInformation.h>
 
 #include <liblangutil/Exceptions.h>
 
+#include <libsolutil/Parallel.h>
+
 #include <fstream>
 #include <json/json.h>
 
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::evmasm;
@@ -232,9 +241,9 @@ Json::Value Assembly::assemblyJSON(map<string, unsigned> const& _sourceIndices)
 	for (AssemblyItem const& i: m_items)
 	{
 		int sourceIndex = -1;
-		if (i.location().source)
+		if (string const* sourceName = i.location().sourceName())
 		{
-			auto iter = _sourceIndices.find(i.location().source->name());
+			auto iter = _sourceIndices.find(*sourceName);
 			if (iter != _sourceIndices.end())
 				sourceIndex = static_cast<int>(iter->second);
 		}
@@ -371,6 +380,109 @@ AssemblyItem Assembly::newImmutableAssignment(string const& _identifier)
 	return AssemblyItem{AssignImmutable, h};
 }
 
+namespace
+{
+
+void collectAssemblies(Assembly const& _assembly, set<Assembly const*>& _assemblies)
+{
+	if (!_assemblies.insert(&_assembly).second)
+		return;
+	for (size_t subId = 0; subId < _assembly.numSubs(); ++subId)
+		collectAssemblies(_assembly.sub(subId), _assemblies);
+}
+
+/// Hash and equality of the chunks fed into the common subexpression eliminator. Source locations
+/// are ignored because they do not influence the result of the optimisation, only its locations.
+size_t cseChunkHash(AssemblyItems::const_iterator _begin, AssemblyItems::const_iterator _end)
+{
+	size_t seed = static_cast<size_t>(_end - _begin);
+	for (auto it = _begin; it != _end; ++it)
+	{
+		AssemblyItem const& item = *it;
+		boost::hash_combine(seed, static_cast<int>(item.type()));
+		if (item.type() == Operation)
+			boost::hash_combine(seed, static_cast<uint8_t>(item.instruction()));
+		else
+			boost::hash_combine(seed, static_cast<size_t>(item.data() & numeric_limits<size_t>::max()));
+		boost::hash_combine(seed, static_cast<int>(item.getJumpType()));
+	}
+	return seed;
+}
+
+bool cseChunksEqual(
+	AssemblyItems::const_iterator _begin,
+	AssemblyItems::const_iterator _end,
+	AssemblyItems::const_iterator _otherBegin,
+	AssemblyItems::const_iterator _otherEnd
+)
+{
+	return equal(_begin, _end, _otherBegin, _otherEnd, [](AssemblyItem const& _x, AssemblyItem const& _y) {
+		return _x == _y && _x.getJumpType() == _y.getJumpType();
+	});
+}
+
+/// @returns the indices of @a _subs partitioned into groups such that sub-assemblies in
+/// different groups do not share any (nested) assembly. The same assembly can be
+/// a sub-assembly several times, e.g. if a contract is created in multiple places.
+/// The groups and the indices within them are sorted.
+vector<vector<size_t>> independentSubGroups(vector<shared_ptr<Assembly>> const& _subs, size_t _parallelism)
+{
+	if (_subs.empty())
+		return {};
+	if (_parallelism <= 1 || _subs.size() == 1)
+	{
+		vector<size_t> all(_subs.size());
+		iota(all.begin(), all.end(), 0);
+		return {move(all)};
+	}
+
+	vector<vector<size_t>> groups;
+	vector<set<Assembly const*>> groupAssemblies;
+	map<Assembly const*, size_t> groupOf;
+	for (size_t subId = 0; subId < _subs.size(); ++subId)
+	{
+		set<Assembly const*> assemblies;
+		collectAssemblies(*_subs[subId], assemblies);
+		set<size_t> sharingGroups;
+		for (Assembly const* assembly: assemblies)
+			if (auto it = groupOf.find(assembly); it != groupOf.end())
+				sharingGroups.insert(it->second);
+
+		size_t group = groups.size();
+		if (sharingGroups.empty())
+		{
+			groups.emplace_back();
+			groupAssemblies.emplace_back();
+		}
+		else
+			group = *sharingGroups.begin();
+		for (size_t other: sharingGroups)
+			if (other != group)
+			{
+				groups[group] += move(groups[other]);
+				groups[other].clear();
+				for (Assembly const* assembly: groupAssemblies[other])
+					groupOf[assembly] = group;
+				groupAssemblies[group] += move(groupAssemblies[other]);
+				groupAssemblies[other].clear();
+			}
+		groups[group].push_back(subId);
+		for (Assembly const* assembly: assemblies)
+			groupOf[assembly] = group;
+		groupAssemblies[group] += move(assemblies);
+	}
+
+	groups.erase(
+		remove_if(groups.begin(), groups.end(), [](vector<size_t> const& _group) { return _group.empty(); }),
+		groups.end()
+	);
+	for (auto& group: groups)
+		sort(group.begin(), group.end());
+	return groups;
+}
+
+}
+
 Assembly& Assembly::optimise(bool _enable, EVMVersion _evmVersion, bool _isCreation, size_t _runs)
 {
 	OptimiserSettings settings;
@@ -401,21 +513,38 @@ map<u256, u256> Assembly::optimiseInternal(
 	std::set<size_t> _tagsReferencedFromOutside
 )
 {
-	// Run optimisation for sub-assemblies.
+	// Run optimisation for sub-assemblies. Groups of sub-assemblies that do not share
+	// any assembly are independent of each other and can be optimised concurrently.
+	vector<vector<size_t>> groups = independentSubGroups(m_subs, _settings.parallelism);
+	OptimiserSettings settings = _settings;
+	// Disable creation mode for sub-assemblies.
+	settings.isCreation = false;
+	settings.parallelism = max<size_t>(1, _settings.parallelism / max<size_t>(1, groups.size()));
+	vector<map<u256, u256>> subTagReplacements(m_subs.size());
+	vector<exception_ptr> exceptions = util::parallelFor(groups.size(), _settings.parallelism, [&](size_t _group) {
+		for (size_t subId: groups[_group])
+			subTagReplacements[subId] = m_subs[subId]->optimiseInternal(
+				settings,
+				JumpdestRemover::referencedTags(m_items, subId)
+			);
+	});
+	for (exception_ptr const& exception: exceptions)
+		if (exception)
+			rethrow_exception(exception);
+	// Apply the replacements (can be empty). They only affect the tags of their own
+	// sub-assembly, so the order in which the sub-assemblies were optimised does not matter.
 	for (size_t subId = 0; subId < m_subs.size(); ++subId)
-	{
-		OptimiserSettings settings = _settings;
-		// Disable creation mode for sub-assemblies.
-		settings.isCreation = false;
-		map<u256, u256> subTagReplacements = m_subs[subId]->optimiseInternal(
-			settings,
-			JumpdestRemover::referencedTags(m_items, subId)
-		);
-		// Apply the replacements (can be empty).
-		BlockDeduplicator::applyTagReplacement(m_items, subTagReplacements, subId);
-	}
+		BlockDeduplicator::applyTagReplacement(m_items, subTagReplacements[subId], subId);
 
 	map<u256, u256> tagReplacements;
+	// MSIZE is never introduced by the optimiser, so once it is gone, it does not have to be searched for again.
+	bool usesMSize = true;
+	// The items after the previous run of the common subexpression eliminator and the
+	// ranges of the chunks in them it could not shorten, keyed by their hash. Every chunk is
+	// optimised starting from an empty state, so the result will be the same as long as the
+	// chunk itself (and usesMSize) did not change.
+	AssemblyItems previousCSEItems;
+	unordered_multimap<size_t, pair<size_t, size_t>> unimprovableCSEChunks;
 	// Iterate until no new optimisation possibilities are found.
 	for (unsigned count = 1; count > 0;)
 	{
@@ -471,11 +600,45 @@ map<u256, u256> Assembly::optimiseInternal(
 			// function types that can be stored in storage.
 			AssemblyItems optimisedItems;
 
-			bool usesMSize = (find(m_items.begin(), m_items.end(), AssemblyItem{Instruction::MSIZE}) != m_items.end());
+			if (usesMSize && find(m_items.begin(), m_items.end(), AssemblyItem{Instruction::MSIZE}) == m_items.end())
+			{
+				usesMSize = false;
+				unimprovableCSEChunks.clear();
+			}
 
+			unordered_multimap<size_t, pair<size_t, size_t>> newUnimprovableCSEChunks;
 			auto iter = m_items.begin();
 			while (iter != m_items.end())
 			{
+				auto chunkEnd = find_if(iter, m_items.end(), [&](AssemblyItem const& _item) {
+					return SemanticInformation::breaksCSEAnalysisBlock(_item, usesMSize);
+				});
+				if (chunkEnd != m_items.end())
+					++chunkEnd;
+				size_t chunkHash = cseChunkHash(iter, chunkEnd);
+				auto [candidate, candidatesEnd] = unimprovableCSEChunks.equal_range(chunkHash);
+				for (; candidate != candidatesEnd; ++candidate)
+				{
+					auto [begin, end] = candidate->second;
+					if (cseChunksEqual(
+						iter,
+						chunkEnd,
+						previousCSEItems.begin() + static_cast<ptrdiff_t>(begin),
+						previousCSEItems.begin() + static_cast<ptrdiff_t>(end)
+					))
+						break;
+				}
+				if (candidate != candidatesEnd)
+				{
+					newUnimprovableCSEChunks.emplace(
+						chunkHash,
+						make_pair(optimisedItems.size(), optimisedItems.size() + static_cast<size_t>(chunkEnd - iter))
+					);
+					optimisedItems.insert(optimisedItems.end(), iter, chunkEnd);
+					iter = chunkEnd;
+					continue;
+				}
+
 				KnownState emptyState;
 				CommonSubexpressionEliminator eliminator{emptyState};
 				auto orig = iter;
@@ -498,19 +661,28 @@ map<u256, u256> Assembly::optimiseInternal(
 					// reorganise the expression tree, but not all leaves are available.
 				}
 
+				assertThrow(iter == chunkEnd, OptimizerException, "Unexpected end of CSE chunk.");
 				if (shouldReplace)
 				{
 					count++;
 					optimisedItems += optimisedChunk;
 				}
 				else
-					copy(orig, iter, back_inserter(optimisedItems));
+				{
+					newUnimprovableCSEChunks.emplace(
+						chunkHash,
+						make_pair(optimisedItems.size(), optimisedItems.size() + static_cast<size_t>(chunkEnd - orig))
+					);
+					optimisedItems.insert(optimisedItems.end(), orig, chunkEnd);
+				}
 			}
+			unimprovableCSEChunks = move(newUnimprovableCSEChunks);
 			if (optimisedItems.size() < m_items.size())
 			{
-				m_items = move(optimisedItems);
+				m_items = optimisedItems;
 				count++;
 			}
+			previousCSEItems = move(optimisedItems);
 		}
 	}
 
@@ -645,7 +817,7 @@ LinkerObject const& Assembly::assemble() const
 		{
 			assertThrow(i.data() <= numeric_limits<size_t>::max(), AssemblyException, "");
 			auto s = subAssemblyById(static_cast<size_t>(i.data()))->assemble().bytecode.size();
-			i.setPushedValue(u256(s));
+			i.setPushedValue(s);
 			unsigned b = max<unsigned>(1, util::bytesRequired(s));
 			ret.bytecode.push_back(static_cast<uint8_t>(pushInstruction(b)));
 			ret.bytecode.resize(ret.bytecode.size() + b);
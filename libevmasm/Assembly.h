@@ -35,6 +35,7 @@
 #include <iostream>
 #include <sstream>
 #include <memory>
+#include <set>
 
 namespace solidity::evmasm
 {
@@ -97,7 +98,13 @@ public:
 	void setDeposit(int _deposit) { m_deposit = _deposit; assertThrow(m_deposit >= 0, InvalidDeposit, ""); }
 
 	/// Changes the source location used for each appended item.
-	void setSourceLocation(langutil::SourceLocation const& _location) { m_currentSourceLocation = _location; }
+	void setSourceLocation(langutil::SourceLocation const& _location)
+	{
+		// The items refer to their sources by index only, so the assembly keeps them alive.
+		if (_location.source && _location.source != m_currentSourceLocation.source)
+			m_sources.insert(_location.source);
+		m_currentSourceLocation = _location;
+	}
 	langutil::SourceLocation const& currentSourceLocation() const { return m_currentSourceLocation; }
 
 	/// Assembles the assembly into bytecode. The assembly should not be modified after this call, since the assembled version is cached.
@@ -115,6 +122,8 @@ public:
 		/// This specifies an estimate on how often each opcode in this assembly will be executed,
 		/// i.e. use a small value to optimise for size and a large value to optimise for runtime gas usage.
 		size_t expectedExecutionsPerDeployment = 200;
+		/// Maximum number of threads used to optimise independent sub-assemblies concurrently.
+		size_t parallelism = 1;
 	};
 
 	/// Modify and return the current assembly such that creation and execution gas usage
@@ -195,6 +204,8 @@ protected:
 	int m_deposit = 0;
 
 	langutil::SourceLocation m_currentSourceLocation;
+	/// The sources the locations of the items refer to.
+	std::set<std::shared_ptr<langutil::CharStream>> m_sources;
 public:
 	size_t m_currentModifierDepth = 0;
 };
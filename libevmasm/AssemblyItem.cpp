@@ -335,12 +335,11 @@ std::string AssemblyItem::computeSourceMapping(
 		if (!ret.empty())
 			ret += ";";
 
-		SourceLocation const& location = item.location();
+		CompactSourceLocation const& location = item.location();
 		int length = location.start != -1 && location.end != -1 ? location.end - location.start : -1;
-		int sourceIndex =
-			location.source && _sourceIndicesMap.count(location.source->name()) ?
-			static_cast<int>(_sourceIndicesMap.at(location.source->name())) :
-			-1;
+		string const* sourceName = location.sourceName();
+		auto sourceIndexIt = sourceName ? _sourceIndicesMap.find(*sourceName) : _sourceIndicesMap.end();
+		int sourceIndex = sourceIndexIt != _sourceIndicesMap.end() ? static_cast<int>(sourceIndexIt->second) : -1;
 		char jump = '-';
 		if (item.getJumpType() == evmasm::AssemblyItem::JumpType::IntoFunction)
 			jump = 'i';
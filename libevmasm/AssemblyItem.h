@@ -24,10 +24,13 @@
 
 #include <libevmasm/Instruction.h>
 #include <libevmasm/Exceptions.h>
+#include <liblangutil/CompactSourceLocation.h>
 #include <liblangutil/SourceLocation.h>
 #include <libsolutil/Common.h>
 #include <libsolutil/Assertions.h>
 #include <iostream>
+#include <memory>
+#include <optional>
 #include <sstream>
 
 namespace solidity::evmasm
@@ -54,26 +57,34 @@ class Assembly;
 class AssemblyItem;
 using AssemblyItems = std::vector<AssemblyItem>;
 
+/**
+ * Item of an assembly, i.e. an instruction, a push or a tag.
+ *
+ * Items are copied a lot by the optimiser, so most of them do not own any heap memory: Data
+ * that fits into 64 bits is stored inline and only larger values (hashes, foreign push tags,
+ * big literals) are shared between copies of an item. The source location refers to its
+ * source by index.
+ */
 class AssemblyItem
 {
 public:
 	enum class JumpType { Ordinary, IntoFunction, OutOfFunction };
 
-	AssemblyItem(u256 _push, langutil::SourceLocation _location = langutil::SourceLocation()):
-		AssemblyItem(Push, std::move(_push), std::move(_location)) { }
-	AssemblyItem(Instruction _i, langutil::SourceLocation _location = langutil::SourceLocation()):
+	AssemblyItem(u256 const& _push, langutil::CompactSourceLocation _location = {}):
+		AssemblyItem(Push, _push, _location) { }
+	AssemblyItem(Instruction _i, langutil::CompactSourceLocation _location = {}):
 		m_type(Operation),
 		m_instruction(_i),
-		m_location(std::move(_location))
+		m_location(_location)
 	{}
-	AssemblyItem(AssemblyItemType _type, u256 _data = 0, langutil::SourceLocation _location = langutil::SourceLocation()):
+	AssemblyItem(AssemblyItemType _type, u256 const& _data = 0, langutil::CompactSourceLocation _location = {}):
 		m_type(_type),
-		m_location(std::move(_location))
+		m_location(_location)
 	{
 		if (m_type == Operation)
 			m_instruction = Instruction(uint8_t(_data));
 		else
-			m_data = std::make_shared<u256>(std::move(_data));
+			setData(_data);
 	}
 	AssemblyItem(AssemblyItem const&) = default;
 	AssemblyItem(AssemblyItem&&) = default;
@@ -92,8 +103,25 @@ public:
 	void setPushTagSubIdAndTag(size_t _subId, size_t _tag);
 
 	AssemblyItemType type() const { return m_type; }
-	u256 const& data() const { assertThrow(m_type != Operation, util::Exception, ""); return *m_data; }
-	void setData(u256 const& _data) { assertThrow(m_type != Operation, util::Exception, ""); m_data = std::make_shared<u256>(_data); }
+	u256 data() const
+	{
+		assertThrow(m_type != Operation, util::Exception, "");
+		return m_largeData ? *m_largeData : u256(m_smallData);
+	}
+	void setData(u256 const& _data)
+	{
+		assertThrow(m_type != Operation, util::Exception, "");
+		if (_data <= std::numeric_limits<uint64_t>::max())
+		{
+			m_smallData = uint64_t(_data);
+			m_largeData = nullptr;
+		}
+		else
+		{
+			m_smallData = 0;
+			m_largeData = std::make_shared<u256 const>(_data);
+		}
+	}
 
 	/// @returns the instruction of this item (only valid if type() == Operation)
 	Instruction instruction() const { assertThrow(m_type == Operation, util::Exception, ""); return m_instruction; }
@@ -105,8 +133,10 @@ public:
 			return false;
 		if (type() == Operation)
 			return instruction() == _other.instruction();
+		else if (m_largeData && _other.m_largeData)
+			return m_largeData == _other.m_largeData || *m_largeData == *_other.m_largeData;
 		else
-			return data() == _other.data();
+			return m_smallData == _other.m_smallData && !m_largeData && !_other.m_largeData;
 	}
 	bool operator!=(AssemblyItem const& _other) const { return !operator==(_other); }
 	/// Less-than operator compatible with operator==.
@@ -116,8 +146,13 @@ public:
 			return type() < _other.type();
 		else if (type() == Operation)
 			return instruction() < _other.instruction();
+		else if (m_largeData && _other.m_largeData)
+			return *m_largeData < *_other.m_largeData;
+		else if (m_largeData || _other.m_largeData)
+			// Large values are greater than all small values.
+			return !m_largeData;
 		else
-			return data() < _other.data();
+			return m_smallData < _other.m_smallData;
 	}
 
 	/// Shortcut that avoids constructing an AssemblyItem just to perform the comparison.
@@ -142,33 +177,39 @@ public:
 	/// @returns true if the assembly item can be used in a functional context.
 	bool canBeFunctional() const;
 
-	void setLocation(langutil::SourceLocation const& _location) { m_location = _location; }
-	langutil::SourceLocation const& location() const { return m_location; }
+	void setLocation(langutil::CompactSourceLocation const& _location) { m_location = _location; }
+	langutil::CompactSourceLocation const& location() const { return m_location; }
 
 	void setJumpType(JumpType _jumpType) { m_jumpType = _jumpType; }
 	JumpType getJumpType() const { return m_jumpType; }
 	std::string getJumpTypeAsString() const;
 
-	void setPushedValue(u256 const& _value) const { m_pushedValue = std::make_shared<u256>(_value); }
-	u256 const* pushedValue() const { return m_pushedValue.get(); }
+	void setPushedValue(size_t _value) const { m_pushedValue = _value; }
+	std::optional<u256> pushedValue() const
+	{
+		return m_pushedValue ? std::optional<u256>(*m_pushedValue) : std::nullopt;
+	}
 
 	std::string toAssemblyText(Assembly const& _assembly) const;
 
 	size_t m_modifierDepth = 0;
 
-	void setImmutableOccurrences(size_t _n) const { m_immutableOccurrences = std::make_shared<size_t>(_n); }
+	void setImmutableOccurrences(size_t _n) const { m_immutableOccurrences = _n; }
 
 private:
 	AssemblyItemType m_type;
 	Instruction m_instruction; ///< Only valid if m_type == Operation
-	std::shared_ptr<u256> m_data; ///< Only valid if m_type != Operation
-	langutil::SourceLocation m_location;
 	JumpType m_jumpType = JumpType::Ordinary;
+	langutil::CompactSourceLocation m_location;
+	/// Data if m_type != Operation and it fits into 64 bits, zero otherwise.
+	uint64_t m_smallData = 0;
+	/// Data if m_type != Operation and it does not fit into 64 bits, shared between copies.
+	std::shared_ptr<u256 const> m_largeData;
 	/// Pushed value for operations with data to be determined during assembly stage,
 	/// e.g. PushSubSize, PushTag, PushSub, etc.
-	mutable std::shared_ptr<u256> m_pushedValue;
+	mutable std::optional<size_t> m_pushedValue;
 	/// Number of PushImmutable's with the same hash. Only used for AssignImmutable.
-	mutable std::shared_ptr<size_t> m_immutableOccurrences;
+	mutable std::optional<size_t> m_immutableOccurrences;
 };
 
 inline size_t bytesRequired(AssemblyItems const& _items, size_t _addressLength)
@@ -27,8 +27,10 @@
 #include <libevmasm/AssemblyItem.h>
 #include <libevmasm/SemanticInformation.h>
 
+#include <boost/functional/hash.hpp>
+
 #include <functional>
-#include <set>
+#include <unordered_set>
 
 using namespace std;
 using namespace solidity;
@@ -49,47 +51,63 @@ bool BlockDeduplicator::deduplicate()
 	)
 		return false;
 
-	function<bool(size_t, size_t)> comparator = [&](size_t _i, size_t _j)
-	{
-		if (_i == _j)
-			return false;
-
-		// To compare recursive loops, we have to already unify PushTag opcodes of the
-		// block's own tag.
-		AssemblyItem pushFirstTag{pushSelf};
-		AssemblyItem pushSecondTag{pushSelf};
+	using diff_type = BlockIterator::difference_type;
+	BlockIterator end{m_items.end(), m_items.end()};
 
+	// To compare recursive loops, we have to already unify PushTag opcodes of the
+	// block's own tag.
+	auto pushOwnTag = [&](size_t _i)
+	{
 		if (_i < m_items.size() && m_items.at(_i).type() == Tag)
-			pushFirstTag = m_items.at(_i).pushTag();
-		if (_j < m_items.size() && m_items.at(_j).type() == Tag)
-			pushSecondTag = m_items.at(_j).pushTag();
+			return m_items.at(_i).pushTag();
+		return pushSelf;
+	};
+	auto blockBegin = [&](size_t _i, AssemblyItem const& _pushOwnTag)
+	{
+		BlockIterator it{m_items.begin() + diff_type(_i), m_items.end(), &_pushOwnTag, &pushSelf};
+		if (it != end && (*it).type() == Tag)
+			++it;
+		return it;
+	};
 
-		using diff_type = BlockIterator::difference_type;
-		BlockIterator first{m_items.begin() + diff_type(_i), m_items.end(), &pushFirstTag, &pushSelf};
-		BlockIterator second{m_items.begin() + diff_type(_j), m_items.end(), &pushSecondTag, &pushSelf};
-		BlockIterator end{m_items.end(), m_items.end()};
+	// Hashes the suffix that starts at an index consistently with the equality below, i.e.
+	// ignoring tags and the identity of the block's own tag.
+	function<size_t(size_t)> hasher = [&](size_t _i)
+	{
+		AssemblyItem pushTag = pushOwnTag(_i);
+		size_t seed = 0;
+		for (BlockIterator it = blockBegin(_i, pushTag); it != end; ++it)
+		{
+			AssemblyItem const& item = *it;
+			boost::hash_combine(seed, static_cast<int>(item.type()));
+			if (item.type() == Operation)
+				boost::hash_combine(seed, static_cast<uint8_t>(item.instruction()));
+			else
+				boost::hash_combine(seed, static_cast<size_t>(item.data() & numeric_limits<size_t>::max()));
+		}
+		return seed;
+	};
 
-		if (first != end && (*first).type() == Tag)
-			++first;
-		if (second != end && (*second).type() == Tag)
-			++second;
+	function<bool(size_t, size_t)> equal = [&](size_t _i, size_t _j)
+	{
+		if (_i == _j)
+			return true;
 
-		return std::lexicographical_compare(first, end, second, end);
+		AssemblyItem pushFirstTag = pushOwnTag(_i);
+		AssemblyItem pushSecondTag = pushOwnTag(_j);
+		return std::equal(blockBegin(_i, pushFirstTag), end, blockBegin(_j, pushSecondTag), end);
 	};
 
 	size_t iterations = 0;
 	for (; ; ++iterations)
 	{
-		//@todo this should probably be optimized.
-		set<size_t, function<bool(size_t, size_t)>> blocksSeen(comparator);
+		unordered_set<size_t, function<size_t(size_t)>, function<bool(size_t, size_t)>> blocksSeen(0, hasher, equal);
 		for (size_t i = 0; i < m_items.size(); ++i)
 		{
 			if (m_items.at(i).type() != Tag)
 				continue;
-			auto it = blocksSeen.find(i);
-			if (it == blocksSeen.end())
-				blocksSeen.insert(i);
-			else
+			auto [it, inserted] = blocksSeen.insert(i);
+			if (!inserted)
 				m_replacedTags[m_items.at(i).data()] = m_items.at(*it).data();
 		}
 
@@ -56,9 +56,9 @@ vector<AssemblyItem> CommonSubexpressionEliminator::getOptimizedItems()
 	if (!m_state.stackElements().empty())
 		minHeight = min(minHeight, m_state.stackElements().begin()->first);
 	for (int height = minHeight; height <= m_initialState.stackHeight(); ++height)
-		initialStackContents[height] = m_initialState.stackElement(height, SourceLocation());
+		initialStackContents[height] = m_initialState.stackElement(height, CompactSourceLocation());
 	for (int height = minHeight; height <= m_state.stackHeight(); ++height)
-		targetStackContents[height] = m_state.stackElement(height, SourceLocation());
+		targetStackContents[height] = m_state.stackElement(height, CompactSourceLocation());
 
 	AssemblyItems items = CSECodeGenerator(m_state.expressionClasses(), m_storeOperations).generateCode(
 		m_initialState.sequenceNumber(),
@@ -85,7 +85,7 @@ void CommonSubexpressionEliminator::optimizeBreakingItem()
 		return;
 
 	ExpressionClasses& classes = m_state.expressionClasses();
-	SourceLocation const& itemLocation = m_breakingItem->location();
+	CompactSourceLocation const& itemLocation = m_breakingItem->location();
 	if (*m_breakingItem == AssemblyItem(Instruction::JUMPI))
 	{
 		AssemblyItem::JumpType jumpType = m_breakingItem->getJumpType();
@@ -180,7 +180,7 @@ AssemblyItems CSECodeGenerator::generateCode(
 		assertThrow(!m_classPositions[targetItem.second].empty(), OptimizerException, "");
 		if (m_classPositions[targetItem.second].count(targetItem.first))
 			continue;
-		SourceLocation sourceLocation;
+		CompactSourceLocation sourceLocation;
 		if (m_expressionClasses.representative(targetItem.second).item)
 			sourceLocation = m_expressionClasses.representative(targetItem.second).item->location();
 		int position = classElementPosition(targetItem.second);
@@ -264,8 +264,8 @@ void CSECodeGenerator::addDependencies(Id _c)
 				Id length = expr.arguments.at(1);
 				AssemblyItem offsetInstr(Instruction::SUB, expr.item->location());
 				Id offsetToStart = m_expressionClasses.find(offsetInstr, {slot, slotToLoadFrom});
-				u256 const* o = m_expressionClasses.knownConstant(offsetToStart);
-				u256 const* l = m_expressionClasses.knownConstant(length);
+				optional<u256> o = m_expressionClasses.knownConstant(offsetToStart);
+				optional<u256> l = m_expressionClasses.knownConstant(length);
 				if (l && *l == 0)
 					knownToBeIndependent = true;
 				else if (o)
@@ -333,7 +333,7 @@ void CSECodeGenerator::generateClassElement(Id _c, bool _allowSequenced)
 	for (Id arg: boost::adaptors::reverse(arguments))
 		generateClassElement(arg);
 
-	SourceLocation const& itemLocation = expr.item->location();
+	CompactSourceLocation const& itemLocation = expr.item->location();
 	// The arguments are somewhere on the stack now, so it remains to move them at the correct place.
 	// This is quite difficult as sometimes, the values also have to removed in this process
 	// (if canBeRemoved() returns true) and the two arguments can be equal. For now, this is
@@ -466,7 +466,7 @@ bool CSECodeGenerator::removeStackTopIfPossible()
 	return true;
 }
 
-void CSECodeGenerator::appendDup(int _fromPosition, SourceLocation const& _location)
+void CSECodeGenerator::appendDup(int _fromPosition, CompactSourceLocation const& _location)
 {
 	assertThrow(_fromPosition != c_invalidPosition, OptimizerException, "");
 	int instructionNum = 1 + m_stackHeight - _fromPosition;
@@ -477,7 +477,7 @@ void CSECodeGenerator::appendDup(int _fromPosition, SourceLocation const& _locat
 	m_classPositions[m_stack[m_stackHeight]].insert(m_stackHeight);
 }
 
-void CSECodeGenerator::appendOrRemoveSwap(int _fromPosition, SourceLocation const& _location)
+void CSECodeGenerator::appendOrRemoveSwap(int _fromPosition, CompactSourceLocation const& _location)
 {
 	assertThrow(_fromPosition != c_invalidPosition, OptimizerException, "");
 	if (_fromPosition == m_stackHeight)
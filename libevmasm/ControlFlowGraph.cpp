@@ -276,7 +276,7 @@ void ControlFlowGraph::gatherKnowledge()
 			//@todo in the case of JUMPI, add knowledge about the condition to the state
 			// (for both values of the condition)
 			set<u256> tags = state->tagsInExpression(
-				state->stackElement(state->stackHeight(), langutil::SourceLocation{})
+				state->stackElement(state->stackHeight(), langutil::CompactSourceLocation{})
 			);
 			state->feedItem(m_items.at(pc++));
 
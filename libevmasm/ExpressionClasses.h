@@ -30,11 +30,12 @@
 #include <vector>
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
 
 namespace solidity::langutil
 {
-struct SourceLocation;
+struct CompactSourceLocation;
 }
 
 namespace solidity::evmasm
@@ -86,7 +87,7 @@ public:
 	void forceEqual(Id _id, AssemblyItem const& _item, Ids const& _arguments, bool _copyItem = true);
 
 	/// @returns the id of a new class which is different to all other classes.
-	Id newClass(langutil::SourceLocation const& _location);
+	Id newClass(langutil::CompactSourceLocation const& _location);
 
 	/// @returns true if the values of the given classes are known to be different (on every input).
 	/// @note that this function might still return false for some different inputs.
@@ -99,9 +100,8 @@ public:
 	/// @returns true if the value of the given class is known to be nonzero.
 	/// @note that this is not the negation of knownZero
 	bool knownNonZero(Id _c);
-	/// @returns a pointer to the value if the given class is known to be a constant,
-	/// and a nullptr otherwise.
-	u256 const* knownConstant(Id _c);
+	/// @returns the value if the given class is known to be a constant, and nullopt otherwise.
+	std::optional<u256> knownConstant(Id _c);
 
 	/// Stores a copy of the given AssemblyItem and returns a pointer to the copy that is valid for
 	/// the lifetime of the ExpressionClasses object.
@@ -130,7 +130,7 @@ GasMeter::GasConsumption GasMeter::estimateMax(AssemblyItem const& _item, bool _
 		{
 			gas = GasCosts::logGas + GasCosts::logTopicGas * getLogNumber(_item.instruction());
 			gas += memoryGas(0, -1);
-			if (u256 const* value = classes.knownConstant(m_state->relativeStackElement(-1)))
+			if (optional<u256> value = classes.knownConstant(m_state->relativeStackElement(-1)))
 				gas += GasCosts::logDataGas * (*value);
 			else
 				gas = GasConsumption::infinite();
@@ -147,7 +147,7 @@ GasMeter::GasConsumption GasMeter::estimateMax(AssemblyItem const& _item, bool _
 			else
 			{
 				gas = GasCosts::callGas(m_evmVersion);
-				if (u256 const* value = classes.knownConstant(m_state->relativeStackElement(0)))
+				if (optional<u256> value = classes.knownConstant(m_state->relativeStackElement(0)))
 					gas += (*value);
 				else
 					gas = GasConsumption::infinite();
@@ -180,7 +180,7 @@ GasMeter::GasConsumption GasMeter::estimateMax(AssemblyItem const& _item, bool _
 			break;
 		case Instruction::EXP:
 			gas = GasCosts::expGas;
-			if (u256 const* value = classes.knownConstant(m_state->relativeStackElement(-1)))
+			if (optional<u256> value = classes.knownConstant(m_state->relativeStackElement(-1)))
 			{
 				if (*value)
 				{
@@ -218,7 +218,7 @@ GasMeter::GasConsumption GasMeter::estimateMax(AssemblyItem const& _item, bool _
 
 GasMeter::GasConsumption GasMeter::wordGas(u256 const& _multiplier, ExpressionClasses::Id _value)
 {
-	u256 const* value = m_state->expressionClasses().knownConstant(_value);
+	optional<u256> value = m_state->expressionClasses().knownConstant(_value);
 	if (!value)
 		return GasConsumption::infinite();
 	return GasConsumption(_multiplier * ((*value + 31) / 32));
@@ -226,7 +226,7 @@ GasMeter::GasConsumption GasMeter::wordGas(u256 const& _multiplier, ExpressionCl
 
 GasMeter::GasConsumption GasMeter::memoryGas(ExpressionClasses::Id _position)
 {
-	u256 const* value = m_state->expressionClasses().knownConstant(_position);
+	optional<u256> value = m_state->expressionClasses().knownConstant(_position);
 	if (!value)
 		return GasConsumption::infinite();
 	if (*value < m_largestMemoryAccess)
@@ -66,7 +66,7 @@ ostream& KnownState::stream(ostream& _out) const
 		streamExpressionClass(_out, it.second);
 	}
 	_out << "Storage:" << endl;
-	for (auto const& it: m_storageContent)
+	for (auto const& it: *m_storageContent)
 	{
 		_out << "  ";
 		streamExpressionClass(_out, it.first);
@@ -74,7 +74,7 @@ ostream& KnownState::stream(ostream& _out) const
 		streamExpressionClass(_out, it.second);
 	}
 	_out << "Memory:" << endl;
-	for (auto const& it: m_memoryContent)
+	for (auto const& it: *m_memoryContent)
 	{
 		_out << "  ";
 		streamExpressionClass(_out, it.first);
@@ -103,9 +103,9 @@ KnownState::StoreOperation KnownState::feedItem(AssemblyItem const& _item, bool
 	else if (_item.type() != Operation)
 	{
 		assertThrow(_item.deposit() == 1, InvalidDeposit, "");
-		if (_item.pushedValue())
+		if (optional<u256> pushedValue = _item.pushedValue())
 			// only available after assembly stage, should not be used for optimisation
-			setStackElement(++m_stackHeight, m_expressionClasses->find(*_item.pushedValue()));
+			setStackElement(++m_stackHeight, m_expressionClasses->find(*pushedValue));
 		else
 			setStackElement(++m_stackHeight, m_expressionClasses->find(_item, {}, _copyItem));
 	}
@@ -188,62 +188,57 @@ KnownState::StoreOperation KnownState::feedItem(AssemblyItem const& _item, bool
 	return op;
 }
 
-/// Helper function for KnownState::reduceToCommonKnowledge, removes everything from
-/// _this which is not in or not equal to the value in _other.
-template <class Mapping> void intersect(Mapping& _this, Mapping const& _other)
+/// Helper function for KnownState::reduceToCommonKnowledge, @returns everything from
+/// _this which is also in and equal to the value in _other.
+template <class Mapping> Mapping intersection(Mapping const& _this, Mapping const& _other)
 {
-	for (auto it = _this.begin(); it != _this.end();)
-		if (_other.count(it->first) && _other.at(it->first) == it->second)
-			++it;
-		else
-			it = _this.erase(it);
+	Mapping common;
+	common.reserve(_this.size());
+	for (auto const& entry: _this)
+		if (auto it = _other.find(entry.first); it != _other.end() && it->second == entry.second)
+			common.insert(common.end(), entry);
+	return common;
 }
 
 void KnownState::reduceToCommonKnowledge(KnownState const& _other, bool _combineSequenceNumbers)
 {
 	int stackDiff = m_stackHeight - _other.m_stackHeight;
-	for (auto it = m_stackElements.begin(); it != m_stackElements.end();)
-		if (_other.m_stackElements.count(it->first - stackDiff))
-		{
-			Id other = _other.m_stackElements.at(it->first - stackDiff);
-			if (it->second == other)
-				++it;
-			else
-			{
-				set<u256> theseTags = tagsInExpression(it->second);
-				set<u256> otherTags = tagsInExpression(other);
-				if (!theseTags.empty() && !otherTags.empty())
-				{
-					theseTags.insert(otherTags.begin(), otherTags.end());
-					it->second = tagUnion(theseTags);
-					++it;
-				}
-				else
-					it = m_stackElements.erase(it);
-			}
-		}
-		else
-			it = m_stackElements.erase(it);
-
 	// Use the smaller stack height. Essential to terminate in case of loops.
-	if (m_stackHeight > _other.m_stackHeight)
+	int shift = max(stackDiff, 0);
+	// Rebuilt in a single pass, since erasing single elements from the flat map is linear.
+	StackElements commonStack;
+	commonStack.reserve(m_stackElements.size());
+	for (auto const& [height, id]: m_stackElements)
 	{
-		map<int, Id> shiftedStack;
-		for (auto const& stackElement: m_stackElements)
-			shiftedStack[stackElement.first - stackDiff] = stackElement.second;
-		m_stackElements = move(shiftedStack);
-		m_stackHeight = _other.m_stackHeight;
+		auto otherIt = _other.m_stackElements.find(height - stackDiff);
+		if (otherIt == _other.m_stackElements.end())
+			continue;
+		Id common = id;
+		if (id != otherIt->second)
+		{
+			set<u256> theseTags = tagsInExpression(id);
+			set<u256> otherTags = tagsInExpression(otherIt->second);
+			if (theseTags.empty() || otherTags.empty())
+				continue;
+			theseTags.insert(otherTags.begin(), otherTags.end());
+			common = tagUnion(theseTags);
+		}
+		commonStack.emplace_hint(commonStack.end(), height - shift, common);
 	}
+	m_stackElements = move(commonStack);
+	m_stackHeight -= shift;
 
-	intersect(m_storageContent, _other.m_storageContent);
-	intersect(m_memoryContent, _other.m_memoryContent);
+	if (*m_storageContent != *_other.m_storageContent)
+		m_storageContent = intersection(*m_storageContent, *_other.m_storageContent);
+	if (*m_memoryContent != *_other.m_memoryContent)
+		m_memoryContent = intersection(*m_memoryContent, *_other.m_memoryContent);
 	if (_combineSequenceNumbers)
 		m_sequenceNumber = max(m_sequenceNumber, _other.m_sequenceNumber);
 }
 
 bool KnownState::operator==(KnownState const& _other) const
 {
-	if (m_storageContent != _other.m_storageContent || m_memoryContent != _other.m_memoryContent)
+	if (*m_storageContent != *_other.m_storageContent || *m_memoryContent != *_other.m_memoryContent)
 		return false;
 	int stackDiff = m_stackHeight - _other.m_stackHeight;
 	auto thisIt = m_stackElements.cbegin();
@@ -254,7 +249,7 @@ bool KnownState::operator==(KnownState const& _other) const
 	return (thisIt == m_stackElements.cend() && otherIt == _other.m_stackElements.cend());
 }
 
-ExpressionClasses::Id KnownState::stackElement(int _stackHeight, SourceLocation const& _location)
+ExpressionClasses::Id KnownState::stackElement(int _stackHeight, CompactSourceLocation const& _location)
 {
 	if (m_stackElements.count(_stackHeight))
 		return m_stackElements.at(_stackHeight);
@@ -263,18 +258,19 @@ ExpressionClasses::Id KnownState::stackElement(int _stackHeight, SourceLocation
 			m_expressionClasses->find(AssemblyItem(UndefinedItem, _stackHeight, _location));
 }
 
-KnownState::Id KnownState::relativeStackElement(int _stackOffset, SourceLocation const& _location)
+KnownState::Id KnownState::relativeStackElement(int _stackOffset, CompactSourceLocation const& _location)
 {
 	return stackElement(m_stackHeight + _stackOffset, _location);
 }
 
 void KnownState::clearTagUnions()
 {
-	for (auto it = m_stackElements.begin(); it != m_stackElements.end();)
-		if (m_tagUnions.left.count(it->second))
-			it = m_stackElements.erase(it);
-		else
-			++it;
+	StackElements stackElements;
+	stackElements.reserve(m_stackElements.size());
+	for (auto const& stackElement: m_stackElements)
+		if (!m_tagUnions->left.count(stackElement.second))
+			stackElements.insert(stackElements.end(), stackElement);
+	m_stackElements = move(stackElements);
 }
 
 void KnownState::setStackElement(int _stackHeight, Id _class)
@@ -285,7 +281,7 @@ void KnownState::setStackElement(int _stackHeight, Id _class)
 void KnownState::swapStackElements(
 	int _stackHeightA,
 	int _stackHeightB,
-	SourceLocation const& _location
+	CompactSourceLocation const& _location
 )
 {
 	assertThrow(_stackHeightA != _stackHeightB, OptimizerException, "Swap on same stack elements.");
@@ -299,80 +295,80 @@ void KnownState::swapStackElements(
 KnownState::StoreOperation KnownState::storeInStorage(
 	Id _slot,
 	Id _value,
-	SourceLocation const& _location)
+	CompactSourceLocation const& _location)
 {
-	if (m_storageContent.count(_slot) && m_storageContent[_slot] == _value)
+	if (auto it = m_storageContent->find(_slot); it != m_storageContent->end() && it->second == _value)
 		// do not execute the storage if we know that the value is already there
 		return StoreOperation();
 	m_sequenceNumber++;
-	decltype(m_storageContent) storageContents;
+	ContentMap storageContents;
 	// Copy over all values (i.e. retain knowledge about them) where we know that this store
 	// operation will not destroy the knowledge. Specifically, we copy storage locations we know
 	// are different from _slot or locations where we know that the stored value is equal to _value.
-	for (auto const& storageItem: m_storageContent)
+	for (auto const& storageItem: *m_storageContent)
 		if (m_expressionClasses->knownToBeDifferent(storageItem.first, _slot) || storageItem.second == _value)
-			storageContents.insert(storageItem);
+			storageContents.insert(storageContents.end(), storageItem);
 	m_storageContent = move(storageContents);
 
 	AssemblyItem item(Instruction::SSTORE, _location);
 	Id id = m_expressionClasses->find(item, {_slot, _value}, true, m_sequenceNumber);
 	StoreOperation operation{StoreOperation::Storage, _slot, m_sequenceNumber, id};
-	m_storageContent[_slot] = _value;
+	m_storageContent.write()[_slot] = _value;
 	// increment a second time so that we get unique sequence numbers for writes
 	m_sequenceNumber++;
 
 	return operation;
 }
 
-ExpressionClasses::Id KnownState::loadFromStorage(Id _slot, SourceLocation const& _location)
+ExpressionClasses::Id KnownState::loadFromStorage(Id _slot, CompactSourceLocation const& _location)
 {
-	if (m_storageContent.count(_slot))
-		return m_storageContent.at(_slot);
+	if (auto it = m_storageContent->find(_slot); it != m_storageContent->end())
+		return it->second;
 
 	AssemblyItem item(Instruction::SLOAD, _location);
-	return m_storageContent[_slot] = m_expressionClasses->find(item, {_slot}, true, m_sequenceNumber);
+	return m_storageContent.write()[_slot] = m_expressionClasses->find(item, {_slot}, true, m_sequenceNumber);
 }
 
-KnownState::StoreOperation KnownState::storeInMemory(Id _slot, Id _value, SourceLocation const& _location)
+KnownState::StoreOperation KnownState::storeInMemory(Id _slot, Id _value, CompactSourceLocation const& _location)
 {
-	if (m_memoryContent.count(_slot) && m_memoryContent[_slot] == _value)
+	if (auto it = m_memoryContent->find(_slot); it != m_memoryContent->end() && it->second == _value)
 		// do not execute the store if we know that the value is already there
 		return StoreOperation();
 	m_sequenceNumber++;
-	decltype(m_memoryContent) memoryContents;
+	ContentMap memoryContents;
 	// copy over values at points where we know that they are different from _slot by at least 32
-	for (auto const& memoryItem: m_memoryContent)
+	for (auto const& memoryItem: *m_memoryContent)
 		if (m_expressionClasses->knownToBeDifferentBy32(memoryItem.first, _slot))
-			memoryContents.insert(memoryItem);
+			memoryContents.insert(memoryContents.end(), memoryItem);
 	m_memoryContent = move(memoryContents);
 
 	AssemblyItem item(Instruction::MSTORE, _location);
 	Id id = m_expressionClasses->find(item, {_slot, _value}, true, m_sequenceNumber);
 	StoreOperation operation{StoreOperation::Memory, _slot, m_sequenceNumber, id};
-	m_memoryContent[_slot] = _value;
+	m_memoryContent.write()[_slot] = _value;
 	// increment a second time so that we get unique sequence numbers for writes
 	m_sequenceNumber++;
 	return operation;
 }
 
-ExpressionClasses::Id KnownState::loadFromMemory(Id _slot, SourceLocation const& _location)
+ExpressionClasses::Id KnownState::loadFromMemory(Id _slot, CompactSourceLocation const& _location)
 {
-	if (m_memoryContent.count(_slot))
-		return m_memoryContent.at(_slot);
+	if (auto it = m_memoryContent->find(_slot); it != m_memoryContent->end())
+		return it->second;
 
 	AssemblyItem item(Instruction::MLOAD, _location);
-	return m_memoryContent[_slot] = m_expressionClasses->find(item, {_slot}, true, m_sequenceNumber);
+	return m_memoryContent.write()[_slot] = m_expressionClasses->find(item, {_slot}, true, m_sequenceNumber);
 }
 
 KnownState::Id KnownState::applyKeccak256(
 	Id _start,
 	Id _length,
-	SourceLocation const& _location
+	CompactSourceLocation const& _location
 )
 {
 	AssemblyItem keccak256Item(Instruction::KECCAK256, _location);
 	// Special logic if length is a short constant, otherwise we cannot tell.
-	u256 const* l = m_expressionClasses->knownConstant(_length);
+	optional<u256> l = m_expressionClasses->knownConstant(_length);
 	// unknown or too large length
 	if (!l || *l > 128)
 		return m_expressionClasses->find(keccak256Item, {_start, _length}, true, m_sequenceNumber);
@@ -386,8 +382,8 @@ KnownState::Id KnownState::applyKeccak256(
 		);
 		arguments.push_back(loadFromMemory(slot, _location));
 	}
-	if (m_knownKeccak256Hashes.count(arguments))
-		return m_knownKeccak256Hashes.at(arguments);
+	if (auto it = m_knownKeccak256Hashes->find(arguments); it != m_knownKeccak256Hashes->end())
+		return it->second;
 	Id v;
 	// If all arguments are known constants, compute the Keccak-256 here
 	if (all_of(arguments.begin(), arguments.end(), [this](Id _a) { return !!m_expressionClasses->knownConstant(_a); }))
@@ -400,13 +396,13 @@ KnownState::Id KnownState::applyKeccak256(
 	}
 	else
 		v = m_expressionClasses->find(keccak256Item, {_start, _length}, true, m_sequenceNumber);
-	return m_knownKeccak256Hashes[arguments] = v;
+	return m_knownKeccak256Hashes.write()[arguments] = v;
 }
 
 set<u256> KnownState::tagsInExpression(KnownState::Id _expressionId)
 {
-	if (m_tagUnions.left.count(_expressionId))
-		return m_tagUnions.left.at(_expressionId);
+	if (auto it = m_tagUnions->left.find(_expressionId); it != m_tagUnions->left.end())
+		return it->second;
 	// Might be a tag, then return the set of itself.
 	ExpressionClasses::Expression expr = m_expressionClasses->representative(_expressionId);
 	if (expr.item && expr.item->type() == PushTag)
@@ -417,12 +413,12 @@ set<u256> KnownState::tagsInExpression(KnownState::Id _expressionId)
 
 KnownState::Id KnownState::tagUnion(set<u256> _tags)
 {
-	if (m_tagUnions.right.count(_tags))
-		return m_tagUnions.right.at(_tags);
+	if (auto it = m_tagUnions->right.find(_tags); it != m_tagUnions->right.end())
+		return it->second;
 	else
 	{
-		Id id = m_expressionClasses->newClass(SourceLocation());
-		m_tagUnions.right.insert(make_pair(_tags, id));
+		Id id = m_expressionClasses->newClass(CompactSourceLocation());
+		m_tagUnions.write().right.insert(make_pair(_tags, id));
 		return id;
 	}
 }
@@ -38,6 +38,7 @@
 #endif // defined(__clang__)
 
 #include <boost/bimap.hpp>
+#include <boost/container/flat_map.hpp>
 
 #if defined(__clang__)
 #pragma clang diagnostic pop
@@ -50,7 +51,7 @@
 
 namespace solidity::langutil
 {
-struct SourceLocation;
+struct CompactSourceLocation;
 }
 
 namespace solidity::evmasm
@@ -71,6 +72,10 @@ class KnownState
 {
 public:
 	using Id = ExpressionClasses::Id;
+	/// Maps are stored in sorted contiguous memory, since they are small, mostly grow at
+	/// the end (the stack) and the state is copied for every branch that is explored.
+	using StackElements = boost::container::flat_map<int, Id>;
+	using ContentMap = boost::container::flat_map<Id, Id>;
 	struct StoreOperation
 	{
 		enum Target { Invalid, Memory, Storage };
@@ -98,7 +103,7 @@ public:
 
 	/// Resets any knowledge about storage.
 	void resetStorage() { m_storageContent.clear(); }
-	/// Resets any knowledge about storage.
+	/// Resets any knowledge about memory.
 	void resetMemory() { m_memoryContent.clear(); }
 	/// Resets any knowledge about the current stack.
 	void resetStack() { m_stackElements.clear(); m_stackHeight = 0; }
@@ -121,9 +126,9 @@ public:
 
 	/// Retrieves the current equivalence class fo the given stack element (or generates a new
 	/// one if it does not exist yet).
-	Id stackElement(int _stackHeight, langutil::SourceLocation const& _location);
+	Id stackElement(int _stackHeight, langutil::CompactSourceLocation const& _location);
 	/// @returns the stackElement relative to the current stack height.
-	Id relativeStackElement(int _stackOffset, langutil::SourceLocation const& _location = {});
+	Id relativeStackElement(int _stackOffset, langutil::CompactSourceLocation const& _location = {});
 
 	/// @returns its set of tags if the given expression class is a known tag union; returns a set
 	/// containing the tag if it is a PushTag expression and the empty set otherwise.
@@ -133,31 +138,59 @@ public:
 	void clearTagUnions();
 
 	int stackHeight() const { return m_stackHeight; }
-	std::map<int, Id> const& stackElements() const { return m_stackElements; }
+	StackElements const& stackElements() const { return m_stackElements; }
 	ExpressionClasses& expressionClasses() const { return *m_expressionClasses; }
 
-	std::map<Id, Id> const& storageContent() const { return m_storageContent; }
+	ContentMap const& storageContent() const { return *m_storageContent; }
 
 private:
+	/// Member that is shared between copies of the state until one of them modifies it.
+	/// Only the stack changes with almost every item, the other members are rarely modified
+	/// after the state was copied for a new path or block.
+	template <class T>
+	class CopyOnWrite
+	{
+	public:
+		T const& operator*() const { return m_value ? *m_value : empty(); }
+		T const* operator->() const { return &**this; }
+		/// @returns the value for modification, copying it first if it is shared.
+		T& write()
+		{
+			if (!m_value)
+				m_value = std::make_shared<T>();
+			else if (m_value.use_count() > 1)
+				m_value = std::make_shared<T>(*m_value);
+			return *m_value;
+		}
+		void operator=(T _value) { m_value = std::make_shared<T>(std::move(_value)); }
+		void clear() { m_value.reset(); }
+
+	private:
+		static T const& empty() { static T const value; return value; }
+
+		/// Null if empty.
+		std::shared_ptr<T> m_value;
+	};
+
 	/// Assigns a new equivalence class to the next sequence number of the given stack element.
 	void setStackElement(int _stackHeight, Id _class);
 	/// Swaps the given stack elements in their next sequence number.
-	void swapStackElements(int _stackHeightA, int _stackHeightB, langutil::SourceLocation const& _location);
+	void swapStackElements(int _stackHeightA, int _stackHeightB, langutil::CompactSourceLocation const& _location);
 
 	/// Increments the sequence number, deletes all storage information that might be overwritten
 	/// and stores the new value at the given slot.
 	/// @returns the store operation, which might be invalid if storage was not modified
-	StoreOperation storeInStorage(Id _slot, Id _value, langutil::SourceLocation const& _location);
+	StoreOperation storeInStorage(Id _slot, Id _value, langutil::CompactSourceLocation const& _location);
 	/// Retrieves the current value at the given slot in storage or creates a new special sload class.
-	Id loadFromStorage(Id _slot, langutil::SourceLocation const& _location);
+	Id loadFromStorage(Id _slot, langutil::CompactSourceLocation const& _location);
 	/// Increments the sequence number, deletes all memory information that might be overwritten
 	/// and stores the new value at the given slot.
 	/// @returns the store operation, which might be invalid if memory was not modified
-	StoreOperation storeInMemory(Id _slot, Id _value, langutil::SourceLocation const& _location);
+	StoreOperation storeInMemory(Id _slot, Id _value, langutil::CompactSourceLocation const& _location);
 	/// Retrieves the current value at the given slot in memory or creates a new special mload class.
-	Id loadFromMemory(Id _slot, langutil::SourceLocation const& _location);
+	Id loadFromMemory(Id _slot, langutil::CompactSourceLocation const& _location);
 	/// Finds or creates a new expression that applies the Keccak-256 hash function to the contents in memory.
-	Id applyKeccak256(Id _start, Id _length, langutil::SourceLocation const& _location);
+	Id applyKeccak256(Id _start, Id _length, langutil::CompactSourceLocation const& _location);
 
 	/// @returns a new or already used Id representing the given set of tags.
 	Id tagUnion(std::set<u256> _tags);
@@ -165,20 +198,20 @@ private:
 	/// Current stack height, can be negative.
 	int m_stackHeight = 0;
 	/// Current stack layout, mapping stack height -> equivalence class
-	std::map<int, Id> m_stackElements;
+	StackElements m_stackElements;
 	/// Current sequence number, this is incremented with each modification to storage or memory.
 	unsigned m_sequenceNumber = 1;
 	/// Knowledge about storage content.
-	std::map<Id, Id> m_storageContent;
+	CopyOnWrite<ContentMap> m_storageContent;
 	/// Knowledge about memory content. Keys are memory addresses, note that the values overlap
 	/// and are not contained here if they are not completely known.
-	std::map<Id, Id> m_memoryContent;
+	CopyOnWrite<ContentMap> m_memoryContent;
 	/// Keeps record of all Keccak-256 hashes that are computed.
-	std::map<std::vector<Id>, Id> m_knownKeccak256Hashes;
+	CopyOnWrite<std::map<std::vector<Id>, Id>> m_knownKeccak256Hashes;
 	/// Structure containing the classes of equivalent expressions.
 	std::shared_ptr<ExpressionClasses> m_expressionClasses;
 	/// Container for unions of tags stored on the stack.
-	boost::bimap<Id, std::set<u256>> m_tagUnions;
+	CopyOnWrite<boost::bimap<Id, std::set<u256>>> m_tagUnions;
 };
 
 }
@@ -98,6 +98,7 @@ struct SimplePeepholeOptimizerMethod
 
 struct Identity: SimplePeepholeOptimizerMethod<Identity, 1>
 {
+	static bool mayStartWith(AssemblyItem const&) { return true; }
 	static bool applySimple(AssemblyItem const& _item, std::back_insert_iterator<AssemblyItems> _out)
 	{
 		*_out = _item;
@@ -107,6 +108,14 @@ struct Identity: SimplePeepholeOptimizerMethod<Identity, 1>
 
 struct PushPop: SimplePeepholeOptimizerMethod<PushPop, 2>
 {
+	static bool mayStartWith(AssemblyItem const& _push)
+	{
+		auto t = _push.type();
+		return
+			SemanticInformation::isDupInstruction(_push) ||
+			t == Push || t == PushString || t == PushTag || t == PushSub ||
+			t == PushSubSize || t == PushProgramSize || t == PushData || t == PushLibraryAddress;
+	}
 	static bool applySimple(AssemblyItem const& _push, AssemblyItem const& _pop, std::back_insert_iterator<AssemblyItems>)
 	{
 		auto t = _push.type();
@@ -120,6 +129,7 @@ struct PushPop: SimplePeepholeOptimizerMethod<PushPop, 2>
 
 struct OpPop: SimplePeepholeOptimizerMethod<OpPop, 2>
 {
+	static bool mayStartWith(AssemblyItem const& _op) { return _op.type() == Operation; }
 	static bool applySimple(
 		AssemblyItem const& _op,
 		AssemblyItem const& _pop,
@@ -142,6 +152,7 @@ struct OpPop: SimplePeepholeOptimizerMethod<OpPop, 2>
 
 struct DoubleSwap: SimplePeepholeOptimizerMethod<DoubleSwap, 2>
 {
+	static bool mayStartWith(AssemblyItem const& _s1) { return SemanticInformation::isSwapInstruction(_s1); }
 	static size_t applySimple(AssemblyItem const& _s1, AssemblyItem const& _s2, std::back_insert_iterator<AssemblyItems>)
 	{
 		return _s1 == _s2 && SemanticInformation::isSwapInstruction(_s1);
@@ -150,6 +161,7 @@ struct DoubleSwap: SimplePeepholeOptimizerMethod<DoubleSwap, 2>
 
 struct DoublePush: SimplePeepholeOptimizerMethod<DoublePush, 2>
 {
+	static bool mayStartWith(AssemblyItem const& _push1) { return _push1.type() == Push; }
 	static bool applySimple(AssemblyItem const& _push1, AssemblyItem const& _push2, std::back_insert_iterator<AssemblyItems> _out)
 	{
 		if (_push1.type() == Push && _push2.type() == Push && _push1.data() == _push2.data())
@@ -165,6 +177,7 @@ struct DoublePush: SimplePeepholeOptimizerMethod<DoublePush, 2>
 
 struct CommutativeSwap: SimplePeepholeOptimizerMethod<CommutativeSwap, 2>
 {
+	static bool mayStartWith(AssemblyItem const& _swap) { return _swap == Instruction::SWAP1; }
 	static bool applySimple(AssemblyItem const& _swap, AssemblyItem const& _op, std::back_insert_iterator<AssemblyItems> _out)
 	{
 		// Remove SWAP1 if following instruction is commutative
@@ -183,6 +196,7 @@ struct CommutativeSwap: SimplePeepholeOptimizerMethod<CommutativeSwap, 2>
 
 struct SwapComparison: SimplePeepholeOptimizerMethod<SwapComparison, 2>
 {
+	static bool mayStartWith(AssemblyItem const& _swap) { return _swap == Instruction::SWAP1; }
 	static bool applySimple(AssemblyItem const& _swap, AssemblyItem const& _op, std::back_insert_iterator<AssemblyItems> _out)
 	{
 		static map<Instruction, Instruction> const swappableOps{
@@ -209,6 +223,7 @@ struct SwapComparison: SimplePeepholeOptimizerMethod<SwapComparison, 2>
 /// Remove swapN after dupN
 struct DupSwap: SimplePeepholeOptimizerMethod<DupSwap, 2>
 {
+	static bool mayStartWith(AssemblyItem const& _dupN) { return SemanticInformation::isDupInstruction(_dupN); }
 	static size_t applySimple(
 		AssemblyItem const& _dupN,
 		AssemblyItem const& _swapN,
@@ -232,6 +247,7 @@ struct DupSwap: SimplePeepholeOptimizerMethod<DupSwap, 2>
 
 struct IsZeroIsZeroJumpI: SimplePeepholeOptimizerMethod<IsZeroIsZeroJumpI, 4>
 {
+	static bool mayStartWith(AssemblyItem const& _iszero1) { return _iszero1 == Instruction::ISZERO; }
 	static size_t applySimple(
 		AssemblyItem const& _iszero1,
 		AssemblyItem const& _iszero2,
@@ -258,6 +274,7 @@ struct IsZeroIsZeroJumpI: SimplePeepholeOptimizerMethod<IsZeroIsZeroJumpI, 4>
 
 struct JumpToNext: SimplePeepholeOptimizerMethod<JumpToNext, 3>
 {
+	static bool mayStartWith(AssemblyItem const& _pushTag) { return _pushTag.type() == PushTag; }
 	static size_t applySimple(
 		AssemblyItem const& _pushTag,
 		AssemblyItem const& _jump,
@@ -284,6 +301,7 @@ struct JumpToNext: SimplePeepholeOptimizerMethod<JumpToNext, 3>
 
 struct TagConjunctions: SimplePeepholeOptimizerMethod<TagConjunctions, 3>
 {
+	static bool mayStartWith(AssemblyItem const& _push) { return _push.type() == PushTag || _push.type() == Push; }
 	static bool applySimple(
 		AssemblyItem const& _pushTag,
 		AssemblyItem const& _pushConstant,
@@ -319,6 +337,7 @@ struct TagConjunctions: SimplePeepholeOptimizerMethod<TagConjunctions, 3>
 
 struct TruthyAnd: SimplePeepholeOptimizerMethod<TruthyAnd, 3>
 {
+	static bool mayStartWith(AssemblyItem const& _push) { return _push.type() == Push; }
 	static bool applySimple(
 		AssemblyItem const& _push,
 		AssemblyItem const& _not,
@@ -337,20 +356,22 @@ struct TruthyAnd: SimplePeepholeOptimizerMethod<TruthyAnd, 3>
 /// Removes everything after a JUMP (or similar) until the next JUMPDEST.
 struct UnreachableCode
 {
+	static bool mayStartWith(AssemblyItem const& _item)
+	{
+		return
+			_item == Instruction::JUMP ||
+			_item == Instruction::RETURN ||
+			_item == Instruction::STOP ||
+			_item == Instruction::INVALID ||
+			_item == Instruction::SELFDESTRUCT ||
+			_item == Instruction::REVERT;
+	}
+
 	static bool apply(OptimiserState& _state)
 	{
 		auto it = _state.items.begin() + static_cast<ptrdiff_t>(_state.i);
 		auto end = _state.items.end();
-		if (it == end)
-			return false;
-		if (
-			it[0] != Instruction::JUMP &&
-			it[0] != Instruction::RETURN &&
-			it[0] != Instruction::STOP &&
-			it[0] != Instruction::INVALID &&
-			it[0] != Instruction::SELFDESTRUCT &&
-			it[0] != Instruction::REVERT
-		)
+		if (it == end || !mayStartWith(it[0]))
 			return false;
 
 		ptrdiff_t i = 1;
@@ -367,16 +388,43 @@ struct UnreachableCode
 	}
 };
 
-void applyMethods(OptimiserState&)
+using MethodFunction = bool(*)(OptimiserState&);
+
+/// Number of distinct keys returned by dispatchKey: one per opcode and one per non-operation item type.
+size_t constexpr numDispatchKeys = 0x100 + AssignImmutable + 1;
+
+size_t dispatchKey(AssemblyItem const& _item)
 {
-	assertThrow(false, OptimizerException, "Peephole optimizer failed to apply identity.");
+	if (_item.type() == Operation)
+		return static_cast<uint8_t>(_item.instruction());
+	else
+		return 0x100 + static_cast<size_t>(_item.type());
 }
 
-template <typename Method, typename... OtherMethods>
-void applyMethods(OptimiserState& _state, Method, OtherMethods... _other)
+/// @returns, for every dispatch key, the methods (in the given order of priority) that can
+/// match at a position whose first item has this key. Every method has to decide this based
+/// on the type and the instruction of the first item only.
+template <typename... Methods>
+vector<vector<MethodFunction>> buildMethodTable()
 {
-	if (!Method::apply(_state))
-		applyMethods(_state, _other...);
+	vector<vector<MethodFunction>> table(numDispatchKeys);
+	for (size_t key = 0; key < numDispatchKeys; ++key)
+	{
+		AssemblyItem first =
+			key < 0x100 ?
+			AssemblyItem{static_cast<Instruction>(key)} :
+			AssemblyItem{static_cast<AssemblyItemType>(key - 0x100), 0};
+		((Methods::mayStartWith(first) ? table[key].push_back(&Methods::apply) : void()), ...);
+	}
+	return table;
+}
+
+void applyMethods(OptimiserState& _state, vector<MethodFunction> const& _methods)
+{
+	for (MethodFunction method: _methods)
+		if (method(_state))
+			return;
+	assertThrow(false, OptimizerException, "Peephole optimizer failed to apply identity.");
 }
 
 size_t numberOfPops(AssemblyItems const& _items)
@@ -388,14 +436,14 @@ size_t numberOfPops(AssemblyItems const& _items)
 
 bool PeepholeOptimiser::optimise()
 {
+	static vector<vector<MethodFunction>> const methods = buildMethodTable<
+		PushPop, OpPop, DoublePush, DoubleSwap, CommutativeSwap, SwapComparison,
+		DupSwap, IsZeroIsZeroJumpI, JumpToNext, UnreachableCode,
+		TagConjunctions, TruthyAnd, Identity
+	>();
 	OptimiserState state {m_items, 0, std::back_inserter(m_optimisedItems)};
 	while (state.i < m_items.size())
-		applyMethods(
-			state,
-			PushPop(), OpPop(), DoublePush(), DoubleSwap(), CommutativeSwap(), SwapComparison(),
-			DupSwap(), IsZeroIsZeroJumpI(), JumpToNext(), UnreachableCode(),
-			TagConjunctions(), TruthyAnd(), Identity()
-		);
+		applyMethods(state, methods[dispatchKey(m_items[state.i])]);
 	if (m_optimisedItems.size() < m_items.size() || (
 		m_optimisedItems.size() == m_items.size() && (
 			evmasm::bytesRequired(m_optimisedItems, 3) < evmasm::bytesRequired(m_items, 3) ||
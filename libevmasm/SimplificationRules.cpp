@@ -46,17 +46,60 @@ SimplificationRule<Pattern> const* Rules::findFirstMatch(
 	resetMatchGroups();
 
 	assertThrow(_expr.item, OptimizerException, "");
-	for (auto const& rule: m_rules[uint8_t(_expr.item->instruction())])
+	for (auto const* rule: candidateRules(_expr, _classes))
 	{
-		if (rule.pattern.matches(_expr, _classes))
-			if (!rule.feasible || rule.feasible())
-				return &rule;
+		if (rule->pattern.matches(_expr, _classes))
+			if (!rule->feasible || rule->feasible())
+				return rule;
 
 		resetMatchGroups();
 	}
 	return nullptr;
 }
 
+vector<SimplificationRule<Pattern> const*> const& Rules::candidateRules(
+	Expression const& _expr,
+	ExpressionClasses const& _classes
+)
+{
+	pair<Instruction, vector<ItemShape>> key{_expr.item->instruction(), {}};
+	for (ExpressionClasses::Id argument: _expr.arguments)
+	{
+		AssemblyItem const* item = _classes.representative(argument).item;
+		if (!item)
+			key.second.emplace_back(UndefinedItem, Instruction::STOP);
+		else if (item->type() == Operation)
+			key.second.emplace_back(Operation, item->instruction());
+		else
+			key.second.emplace_back(item->type(), Instruction::STOP);
+	}
+
+	auto [it, inserted] = m_candidateRules.try_emplace(move(key));
+	if (inserted)
+	{
+		vector<ItemShape> const& argumentShapes = it->first.second;
+		for (auto const& rule: m_rules[uint8_t(it->first.first)])
+		{
+			vector<Pattern> patterns = rule.pattern.arguments();
+			// Differing numbers of arguments are reported by Pattern::matches.
+			bool candidate = true;
+			if (patterns.size() == argumentShapes.size())
+				for (size_t i = 0; i < patterns.size() && candidate; ++i)
+				{
+					Pattern const& pattern = patterns[i];
+					ItemShape const& shape = argumentShapes[i];
+					if (pattern.type() != UndefinedItem)
+						candidate =
+							pattern.type() == shape.first &&
+							(shape.first != Operation || pattern.instruction() == shape.second);
+				}
+			if (candidate)
+				it->second.push_back(&rule);
+		}
+	}
+	return it->second;
+}
+
 bool Rules::isInitialized() const
 {
 	return !m_rules[uint8_t(Instruction::ADD)].empty();
@@ -128,7 +171,7 @@ bool Pattern::matches(Expression const& _expr, ExpressionClasses const& _classes
 	return true;
 }
 
-AssemblyItem Pattern::toAssemblyItem(SourceLocation const& _location) const
+AssemblyItem Pattern::toAssemblyItem(CompactSourceLocation const& _location) const
 {
 	if (m_type == Operation)
 		return AssemblyItem(m_instruction, _location);
@@ -200,7 +243,7 @@ u256 const& Pattern::data() const
 	return *m_data;
 }
 
-ExpressionTemplate::ExpressionTemplate(Pattern const& _pattern, SourceLocation const& _location)
+ExpressionTemplate::ExpressionTemplate(Pattern const& _pattern, CompactSourceLocation const& _location)
 {
 	if (_pattern.matchGroup())
 	{
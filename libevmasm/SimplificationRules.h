@@ -36,7 +36,7 @@
 
 namespace solidity::langutil
 {
-struct SourceLocation;
+struct CompactSourceLocation;
 }
 
 namespace solidity::evmasm
@@ -66,15 +66,28 @@ public:
 	bool isInitialized() const;
 
 private:
+	/// Type and, for operations, instruction of an item.
+	using ItemShape = std::pair<AssemblyItemType, Instruction>;
+
 	void addRules(std::vector<SimplificationRule<Pattern>> const& _rules);
 	void addRule(SimplificationRule<Pattern> const& _rule);
 
+	/// @returns the rules for the instruction of @a _expr whose argument patterns can match
+	/// the items of its arguments, judging only by their types and instructions.
+	std::vector<SimplificationRule<Pattern> const*> const& candidateRules(
+		Expression const& _expr,
+		ExpressionClasses const& _classes
+	);
+
 	void resetMatchGroups() { m_matchGroups.clear(); }
 
 	std::map<unsigned, Expression const*> m_matchGroups;
 	/// Pattern to match, replacement to be applied and flag indicating whether
 	/// the replacement might remove some elements (except constants).
 	std::vector<SimplificationRule<Pattern>> m_rules[256];
+	/// Results of candidateRules, keyed on the instruction and the shapes of the arguments.
+	/// Unlike expression class ids, these keys stay meaningful across ExpressionClasses objects.
+	std::map<std::pair<Instruction, std::vector<ItemShape>>, std::vector<SimplificationRule<Pattern> const*>> m_candidateRules;
 };
 
 /**
@@ -109,13 +122,13 @@ public:
 	unsigned matchGroup() const { return m_matchGroup; }
 	bool matches(Expression const& _expr, ExpressionClasses const& _classes) const;
 
-	AssemblyItem toAssemblyItem(langutil::SourceLocation const& _location) const;
+	AssemblyItem toAssemblyItem(langutil::CompactSourceLocation const& _location) const;
 	std::vector<Pattern> arguments() const { return m_arguments; }
 
 	/// @returns the id of the matched expression if this pattern is part of a match group.
 	Id id() const { return matchGroupValue().id; }
 	/// @returns the data of the matched expression if this pattern is part of a match group.
-	u256 const& d() const { return matchGroupValue().item->data(); }
+	u256 d() const { return matchGroupValue().item->data(); }
 
 	std::string toString() const;
 
@@ -147,7 +160,7 @@ struct ExpressionTemplate
 {
 	using Expression = ExpressionClasses::Expression;
 	using Id = ExpressionClasses::Id;
-	explicit ExpressionTemplate(Pattern const& _pattern, langutil::SourceLocation const& _location);
+	explicit ExpressionTemplate(Pattern const& _pattern, langutil::CompactSourceLocation const& _location);
 	std::string toString() const;
 	bool hasId = false;
 	/// Id of the matched expression, if available.
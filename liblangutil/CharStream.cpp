@@ -57,6 +57,14 @@ using namespace std;
 using namespace solidity;
 using namespace solidity::langutil;
 
+CharStream::CharStream(string _source, string _name):
+	m_name(move(_name))
+{
+	auto source = make_shared<string const>(move(_source));
+	m_source = *source;
+	m_owner = move(source);
+}
+
 char CharStream::advanceAndGet(size_t _chars)
 {
 	if (isPastEndOfInput())
@@ -93,10 +101,10 @@ string CharStream::lineAtPosition(int _position) const
 		lineStart = 0;
 	else
 		lineStart++;
-	string line = m_source.substr(
+	string line{m_source.substr(
 		lineStart,
 		min(m_source.find('\n', lineStart), m_source.size()) - lineStart
-	);
+	)};
 	if (!line.empty() && line.back() == '\r')
 		line.pop_back();
 	return line;
@@ -53,7 +53,9 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <utility>
 
@@ -64,18 +66,30 @@ namespace solidity::langutil
  * Bidirectional stream of characters.
  *
  * This CharStream is used by lexical analyzers as the source.
+ *
+ * The characters are immutable. They are either owned by the stream or an external buffer
+ * like a memory-mapped file, and copies of the stream share them.
  */
 class CharStream
 {
 public:
 	CharStream() = default;
-	explicit CharStream(std::string  _source, std::string  name):
-		m_source(std::move(_source)), m_name(std::move(name)) {}
+	explicit CharStream(std::string _source, std::string _name);
+	/// Creates a stream of the characters in @a _source, which must not change and is kept alive
+	/// by @a _owner. If @a _owner is null, the caller has to ensure that @a _source outlives the
+	/// stream and all its copies.
+	CharStream(std::string_view _source, std::shared_ptr<void const> _owner, std::string _name):
+		m_owner(std::move(_owner)), m_source(_source), m_name(std::move(_name)) {}
 
 	size_t position() const { return m_position; }
 	bool isPastEndOfInput(size_t _charsForward = 0) const { return (m_position + _charsForward) >= m_source.size(); }
 
-	char get(size_t _charsForward = 0) const { return m_source[m_position + _charsForward]; }
+	/// @returns the character @a _charsForward characters ahead, or zero past the end of the input.
+	/// The characters are not necessarily zero-terminated (e.g. in a mapped file).
+	char get(size_t _charsForward = 0) const
+	{
+		return isPastEndOfInput(_charsForward) ? 0 : m_source[m_position + _charsForward];
+	}
 	char advanceAndGet(size_t _chars = 1);
 	/// Sets scanner position to @ _amount characters backwards in source text.
 	/// @returns The character of the current location after update is returned.
@@ -87,7 +101,7 @@ public:
 
 	void reset() { m_position = 0; }
 
-	std::string const& source() const noexcept { return m_source; }
+	std::string_view source() const noexcept { return m_source; }
 	std::string const& name() const noexcept { return m_name; }
 
 	///@{
@@ -113,7 +127,8 @@ public:
 	}
 
 private:
-	std::string m_source;
+	std::shared_ptr<void const> m_owner;
+	std::string_view m_source;
 	std::string m_name;
 	size_t m_position{0};
 };
@@ -0,0 +1,164 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <liblangutil/CompactSourceLocation.h>
+
+#include <liblangutil/Exceptions.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::langutil;
+
+namespace
+{
+
+/// The sources referenced by compact source locations. The table does not keep the sources alive.
+/// The slots of destroyed sources are reused, so that the table does not grow in long-running
+/// processes. This is safe because the owners of compact locations keep their sources alive.
+///
+/// The slots are stored in chunks that are never moved, so that they can be read without locking.
+/// A slot is only overwritten once its source was destroyed and is then no longer read.
+class SourceTable
+{
+public:
+	struct Slot
+	{
+		weak_ptr<CharStream> source;
+		string name;
+	};
+
+	uint32_t indexOf(shared_ptr<CharStream> const& _source)
+	{
+		lock_guard<mutex> lock(m_mutex);
+		if (auto it = m_indices.find(_source.get()); it != m_indices.end())
+		{
+			if (sameSource(slot(it->second).source, _source))
+				return it->second;
+			// The entry belongs to a destroyed source that had the same address.
+			m_freeSlots.push_back(it->second);
+			m_indices.erase(it);
+		}
+
+		// Collecting the slots of destroyed sources takes time linear in the number of entries,
+		// so it is only done after as many registrations as there were entries left.
+		if (m_freeSlots.empty() && m_registrationsUntilCollection == 0)
+		{
+			for (auto entry = m_indices.begin(); entry != m_indices.end();)
+				if (slot(entry->second).source.expired())
+				{
+					m_freeSlots.push_back(entry->second);
+					entry = m_indices.erase(entry);
+				}
+				else
+					++entry;
+			m_registrationsUntilCollection = max<size_t>(m_indices.size(), 1);
+		}
+
+		uint32_t index = 0;
+		if (!m_freeSlots.empty())
+		{
+			index = m_freeSlots.back();
+			m_freeSlots.pop_back();
+		}
+		else
+		{
+			solAssert(m_size < MaxChunks * ChunkSize, "Too many sources.");
+			unique_ptr<Slot[]>& chunk = m_chunkStorage[m_size / ChunkSize];
+			if (!chunk)
+			{
+				chunk = make_unique<Slot[]>(ChunkSize);
+				m_chunks[m_size / ChunkSize].store(chunk.get(), memory_order_release);
+			}
+			index = ++m_size;
+		}
+		m_chunkStorage[(index - 1) / ChunkSize][(index - 1) % ChunkSize] = Slot{_source, _source->name()};
+		m_indices.emplace(_source.get(), index);
+		if (m_registrationsUntilCollection > 0)
+			--m_registrationsUntilCollection;
+		return index;
+	}
+
+	/// @returns the slot of the source with index @a _index (starting at one).
+	/// Does not lock, since slots are not modified while their source is alive.
+	Slot const& slot(uint32_t _index) const
+	{
+		return m_chunks[(_index - 1) / ChunkSize].load(memory_order_acquire)[(_index - 1) % ChunkSize];
+	}
+
+	static bool sameSource(weak_ptr<CharStream> const& _a, shared_ptr<CharStream> const& _b)
+	{
+		return !_a.owner_before(_b) && !_b.owner_before(_a);
+	}
+
+private:
+	static size_t constexpr ChunkSize = 4096;
+	static size_t constexpr MaxChunks = 16384;
+
+	mutex m_mutex;
+	unordered_map<CharStream const*, uint32_t> m_indices;
+	/// Slots of destroyed sources that can be reused.
+	vector<uint32_t> m_freeSlots;
+	size_t m_registrationsUntilCollection = 0;
+	uint32_t m_size = 0;
+	array<atomic<Slot*>, MaxChunks> m_chunks{};
+	array<unique_ptr<Slot[]>, MaxChunks> m_chunkStorage;
+};
+
+SourceTable& sourceTable()
+{
+	static SourceTable table;
+	return table;
+}
+
+}
+
+uint32_t CompactSourceLocation::indexOf(shared_ptr<CharStream> const& _source)
+{
+	// Nodes are usually created from locations in the same source as the previous ones.
+	// The cached source is compared by its control block, which cannot be reused while
+	// the weak pointer exists.
+	thread_local weak_ptr<CharStream> lastSource;
+	thread_local uint32_t lastIndex = 0;
+	if (lastIndex != 0 && SourceTable::sameSource(lastSource, _source))
+		return lastIndex;
+
+	lastIndex = sourceTable().indexOf(_source);
+	lastSource = _source;
+	return lastIndex;
+}
+
+string const* CompactSourceLocation::sourceName() const
+{
+	return sourceIndex != 0 ? &sourceTable().slot(sourceIndex).name : nullptr;
+}
+
+CompactSourceLocation::operator SourceLocation() const
+{
+	SourceLocation location{start, end, {}};
+	if (sourceIndex != 0)
+		location.source = sourceTable().slot(sourceIndex).source.lock();
+	return location;
+}
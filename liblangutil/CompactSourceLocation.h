@@ -0,0 +1,78 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Compact source location stored in the Yul AST and in assembly items.
+ */
+
+#pragma once
+
+#include <liblangutil/SourceLocation.h>
+
+#include <cstdint>
+#include <string>
+
+namespace solidity::langutil
+{
+
+/**
+ * Source location of a Yul AST node or an assembly item.
+ *
+ * In contrast to SourceLocation, it does not hold a shared pointer to the source,
+ * but refers to it by an index into a global table of sources. This halves the size of the
+ * location and copying AST nodes or assembly items (which the optimisers do a lot) does not
+ * have to update reference counts anymore.
+ *
+ * It converts implicitly from and to SourceLocation. Sources are registered on the first
+ * conversion. The table does not keep them alive, so the owner of compact locations has to keep
+ * a reference to their sources, like the scanner, the Solidity AST or the assembly do. The index
+ * of a destroyed source is reused for other sources, so a location must not be used after its
+ * source was destroyed.
+ */
+struct CompactSourceLocation
+{
+	CompactSourceLocation() = default;
+	CompactSourceLocation(SourceLocation const& _location):
+		start(_location.start),
+		end(_location.end),
+		sourceIndex(_location.source ? indexOf(_location.source) : 0)
+	{}
+
+	operator SourceLocation() const;
+
+	bool operator==(CompactSourceLocation const& _other) const
+	{
+		return sourceIndex == _other.sourceIndex && start == _other.start && end == _other.end;
+	}
+	bool operator!=(CompactSourceLocation const& _other) const { return !operator==(_other); }
+
+	bool hasSource() const { return sourceIndex != 0; }
+	/// @returns the name of the source or nullptr if there is no source.
+	/// In contrast to the conversion to SourceLocation, it does not access the source itself.
+	std::string const* sourceName() const;
+	bool isValid() const { return hasSource() || start != -1 || end != -1; }
+
+	int start = -1;
+	int end = -1;
+	/// One plus the index of the source in the global table, zero if there is no source.
+	std::uint32_t sourceIndex = 0;
+
+private:
+	static std::uint32_t indexOf(std::shared_ptr<CharStream> const& _source);
+};
+
+}
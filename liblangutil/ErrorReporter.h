@@ -52,6 +52,10 @@ public:
 		m_errorList += _errorList;
 	}
 
+	/// Adds errors that were reported to another list, e.g. by a check that ran concurrently.
+	/// In contrast to append(), the limits on the number of warnings and errors apply.
+	void merge(ErrorList const& _errorList);
+
 	void warning(ErrorId _error, std::string const& _description);
 
 	void warning(ErrorId _error, SourceLocation const& _location, std::string const& _description);
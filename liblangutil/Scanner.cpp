@@ -60,6 +60,10 @@
 #include <string_view>
 #include <tuple>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 using namespace std;
 
 namespace solidity::langutil {
@@ -256,11 +260,127 @@ Token Scanner::selectToken(char _next, Token _then, Token _else)
 		return _else;
 }
 
+namespace
+{
+
+#if defined(__SSE2__)
+/// @returns a mask of the bytes of @a _characters that lie in the ASCII range [@a _first, @a _last].
+/// Bytes above 0x7f are negative in the signed comparison and never lie in the range.
+__m128i inRange(__m128i _characters, char _first, char _last)
+{
+	return _mm_and_si128(
+		_mm_cmpgt_epi8(_characters, _mm_set1_epi8(char(_first - 1))),
+		_mm_cmplt_epi8(_characters, _mm_set1_epi8(char(_last + 1)))
+	);
+}
+
+__m128i equal(__m128i _characters, char _character)
+{
+	return _mm_cmpeq_epi8(_characters, _mm_set1_epi8(_character));
+}
+#endif
+
+/// Character classes for skipWhile(). Each class tests single characters and, if SSE2 is
+/// available, sixteen characters at once, returning a mask of the matching bytes.
+struct WhiteSpace
+{
+	static bool matches(char _c) { return isWhiteSpace(_c); }
+#if defined(__SSE2__)
+	static __m128i matches(__m128i _c)
+	{
+		return _mm_or_si128(
+			_mm_or_si128(equal(_c, ' '), equal(_c, '\n')),
+			_mm_or_si128(equal(_c, '\t'), equal(_c, '\r'))
+		);
+	}
+#endif
+};
+
+struct IdentifierPart
+{
+	static bool matches(char _c) { return isIdentifierPart(_c); }
+#if defined(__SSE2__)
+	static __m128i matches(__m128i _c)
+	{
+		// Setting bit 5 maps upper case letters to lower case ones and no other character to a letter.
+		return _mm_or_si128(
+			_mm_or_si128(inRange(_mm_or_si128(_c, _mm_set1_epi8(0x20)), 'a', 'z'), inRange(_c, '0', '9')),
+			_mm_or_si128(equal(_c, '_'), equal(_c, '$'))
+		);
+	}
+#endif
+};
+
+/// ASCII characters that do not end a single-line comment. Non-ASCII characters have to be
+/// checked for unicode line breaks separately.
+struct SingleLineCommentPart
+{
+	static bool matches(char _c) { return uint8_t(_c) < 0x80 && (_c < 0x0a || _c > 0x0d); }
+#if defined(__SSE2__)
+	static __m128i matches(__m128i _c)
+	{
+		return _mm_andnot_si128(inRange(_c, 0x0a, 0x0d), _mm_cmpgt_epi8(_c, _mm_set1_epi8(-1)));
+	}
+#endif
+};
+
+/// Characters that neither end a line nor might end a multi-line comment.
+struct MultiLineCommentPart
+{
+	static bool matches(char _c) { return _c != '*' && _c != '\n' && _c != '\r'; }
+#if defined(__SSE2__)
+	static __m128i matches(__m128i _c)
+	{
+		return _mm_andnot_si128(
+			_mm_or_si128(equal(_c, '*'), _mm_or_si128(equal(_c, '\n'), equal(_c, '\r'))),
+			_mm_set1_epi8(-1)
+		);
+	}
+#endif
+};
+
+struct NotAsterisk
+{
+	static bool matches(char _c) { return _c != '*'; }
+#if defined(__SSE2__)
+	static __m128i matches(__m128i _c)
+	{
+		return _mm_andnot_si128(equal(_c, '*'), _mm_set1_epi8(-1));
+	}
+#endif
+};
+
+/// @returns the position of the first character of @a _text at or after @a _position that is not
+/// in @a CharacterClass, or the size of @a _text if there is no such character.
+/// Uses SSE2 to test sixteen characters at once where available.
+template <typename CharacterClass>
+size_t skipWhile(string_view _text, size_t _position)
+{
+#if defined(__SSE2__)
+	for (; _position + 16 <= _text.size(); _position += 16)
+	{
+		__m128i const characters = _mm_loadu_si128(reinterpret_cast<__m128i const*>(_text.data() + _position));
+		unsigned const mismatches = ~static_cast<unsigned>(_mm_movemask_epi8(CharacterClass::matches(characters))) & 0xffffu;
+		if (mismatches != 0)
+			return _position + static_cast<size_t>(__builtin_ctz(mismatches));
+	}
+#endif
+	while (_position < _text.size() && CharacterClass::matches(_text[_position]))
+		++_position;
+	return _position;
+}
+
+}
+
 bool Scanner::skipWhitespace()
 {
 	size_t const startPosition = sourcePos();
-	while (isWhiteSpace(m_char))
-		advance();
+	if (!isWhiteSpace(m_char))
+		return false;
+	// m_char is not necessarily the character at the current position (see skipMultiLineComment),
+	// so the source is only read directly from the next character on.
+	advance();
+	m_char = m_source->setPosition(skipWhile<WhiteSpace>(m_source->source(), sourcePos()));
 	// Return whether or not we skipped any characters.
 	return sourcePos() != startPosition;
 }
@@ -294,11 +414,16 @@ static ScannerError validateBiDiMarkup(CharStream& _stream, size_t _startPositio
 	};
 
 	size_t endPosition = _stream.position();
-	_stream.setPosition(_startPosition);
+	// All directional sequences start with the same byte, so only its occurrences have to be checked.
+	string_view const text = _stream.source().substr(0, endPosition);
 
 	int directionOverrideDepth = 0;
 
-	for (size_t currentPos = _startPosition; currentPos < endPosition; ++currentPos)
+	for (
+		size_t currentPos = text.find('\xE2', _startPosition);
+		currentPos != string_view::npos;
+		currentPos = text.find('\xE2', currentPos + 1)
+	)
 	{
 		_stream.setPosition(currentPos);
 
@@ -322,9 +447,15 @@ Token Scanner::skipSingleLineComment()
 	// Line terminator is not part of the comment. If it is a
 	// non-ascii line terminator, it will result in a parser error.
 	size_t startPosition = m_source->position();
-	while (!isUnicodeLinebreak())
-		if (!advance())
+	size_t position = startPosition;
+	while (true)
+	{
+		m_char = m_source->setPosition(skipWhile<SingleLineCommentPart>(m_source->source(), position));
+		if (isSourcePastEndOfInput() || isUnicodeLinebreak())
 			break;
+		// Non-ASCII character that is not a line break.
+		position = sourcePos() + 1;
+	}
 
 	ScannerError unicodeDirectionError = validateBiDiMarkup(*m_source, startPosition);
 	if (unicodeDirectionError != ScannerError::NoError)
@@ -394,6 +525,15 @@ size_t Scanner::scanSingleLineDocComment()
 			break;
 		addCommentLiteralChar(m_char);
 		advance();
+		// Add the following characters up to the next line break or non-ASCII character at once.
+		size_t const start = sourcePos();
+		size_t const end = skipWhile<SingleLineCommentPart>(m_source->source(), start);
+		if (end != start)
+		{
+			addCommentLiteral(m_source->source().substr(start, end - start));
+			m_char = m_source->setPosition(end);
+			endPosition = end - 1;
+		}
 	}
 	literal.complete();
 	return endPosition;
@@ -402,16 +542,19 @@ size_t Scanner::scanSingleLineDocComment()
 Token Scanner::skipMultiLineComment()
 {
 	size_t startPosition = m_source->position();
-	while (!isSourcePastEndOfInput())
+	string_view const source = m_source->source();
+	for (
+		size_t position = skipWhile<NotAsterisk>(source, startPosition);
+		position + 1 < source.size();
+		position = skipWhile<NotAsterisk>(source, position + 1)
+	)
 	{
-		char prevChar = m_char;
-		advance();
-
 		// If we have reached the end of the multi-line comment, we
 		// consume the '/' and insert a whitespace. This way all
 		// multi-line comments are treated as whitespace.
-		if (prevChar == '*' && m_char == '/')
+		if (source[position + 1] == '/')
 		{
+			m_char = m_source->setPosition(position + 1);
 			ScannerError unicodeDirectionError = validateBiDiMarkup(*m_source, startPosition);
 			if (unicodeDirectionError != ScannerError::NoError)
 				return setError(unicodeDirectionError);
@@ -421,6 +564,7 @@ Token Scanner::skipMultiLineComment()
 		}
 	}
 	// Unterminated multi-line comment.
+	m_char = m_source->setPosition(source.size());
 	return setError(ScannerError::IllegalCommentTerminator);
 }
 
@@ -471,6 +615,11 @@ Token Scanner::scanMultiLineDocComment()
 		addCommentLiteralChar(m_char);
 		charsAdded = true;
 		advance();
+		// Add the following characters up to the next line break or asterisk at once.
+		size_t const start = sourcePos();
+		size_t const end = skipWhile<MultiLineCommentPart>(m_source->source(), start);
+		addCommentLiteral(m_source->source().substr(start, end - start));
+		m_char = m_source->setPosition(end);
 	}
 	literal.complete();
 	if (!endFound)
@@ -1023,8 +1172,18 @@ tuple<Token, unsigned, unsigned> Scanner::scanIdentifierOrKeyword()
 	LiteralScope literal(this, LITERAL_TYPE_STRING);
 	addLiteralCharAndAdvance();
 	// Scan the rest of the identifier characters.
-	while (isIdentifierPart(m_char) || (m_char == '.' && m_kind == ScannerKind::Yul))
-		addLiteralCharAndAdvance();
+	string_view const source = m_source->source();
+	while (true)
+	{
+		size_t const start = sourcePos();
+		size_t const end = skipWhile<IdentifierPart>(source, start);
+		addLiteral(source.substr(start, end - start));
+		m_char = m_source->setPosition(end);
+		if (m_char == '.' && m_kind == ScannerKind::Yul)
+			addLiteralCharAndAdvance();
+		else
+			break;
+	}
 	literal.complete();
 	auto const token = TokenTraits::fromIdentifierOrKeyword(m_tokens[NextNext].literal);
 	if (m_kind == ScannerKind::Yul)
@@ -105,7 +105,7 @@ public:
 	explicit Scanner(std::shared_ptr<CharStream> _source) { reset(std::move(_source)); }
 	explicit Scanner(CharStream _source = CharStream()) { reset(std::move(_source)); }
 
-	std::string const& source() const noexcept { return m_source->source(); }
+	std::string_view source() const noexcept { return m_source->source(); }
 
 	std::shared_ptr<CharStream> charStream() noexcept { return m_source; }
 	std::shared_ptr<CharStream const> charStream() const noexcept { return m_source; }
@@ -207,6 +207,8 @@ private:
 	///@name Literal buffer support
 	inline void addLiteralChar(char c) { m_tokens[NextNext].literal.push_back(c); }
 	inline void addCommentLiteralChar(char c) { m_skippedComments[NextNext].literal.push_back(c); }
+	inline void addLiteral(std::string_view _chars) { m_tokens[NextNext].literal.append(_chars); }
+	inline void addCommentLiteral(std::string_view _chars) { m_skippedComments[NextNext].literal.append(_chars); }
 	inline void addLiteralCharAndAdvance() { addLiteralChar(m_char); advance(); }
 	void addUnicodeAsUTF8(unsigned codepoint);
 	///@}
@@ -25,7 +25,7 @@ using namespace solidity;
 namespace solidity::langutil
 {
 
-SourceLocation const parseSourceLocation(std::string const& _input, std::string const& _sourceName, size_t _maxIndex)
+SourceLocation const parseSourceLocation(std::string const& _input, std::shared_ptr<CharStream> _source, size_t _maxIndex)
 {
 	// Expected input: "start:length:sourceindex"
 	enum SrcElem : size_t { Start, Length, Index };
@@ -43,10 +43,7 @@ SourceLocation const parseSourceLocation(std::string const& _input, std::string
 	int start = stoi(pos[Start]);
 	int end = start + stoi(pos[Length]);
 
-	// ASSUMPTION: only the name of source is used from here on, the m_source of the CharStream-Object can be empty
-	std::shared_ptr<langutil::CharStream> source = std::make_shared<langutil::CharStream>("", _sourceName);
-
-	return SourceLocation{start, end, source};
+	return SourceLocation{start, end, std::move(_source)};
 }
 
 }
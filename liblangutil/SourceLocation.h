@@ -86,7 +86,7 @@ struct SourceLocation
 		assertThrow(0 <= start, SourceLocationError, "Invalid source location.");
 		assertThrow(start <= end, SourceLocationError, "Invalid source location.");
 		assertThrow(end <= int(source->source().length()), SourceLocationError, "Invalid source location.");
-		return source->source().substr(size_t(start), size_t(end - start));
+		return std::string(source->source().substr(size_t(start), size_t(end - start)));
 	}
 
 	/// @returns the smallest SourceLocation that contains both @param _a and @param _b.
@@ -114,9 +114,11 @@ struct SourceLocation
 	std::shared_ptr<CharStream> source;
 };
 
+/// Parses a location of the form "start:length:sourceindex" in @a _source, which only needs to
+/// carry the name of the source.
 SourceLocation const parseSourceLocation(
 	std::string const& _input,
-	std::string const& _sourceName,
+	std::shared_ptr<CharStream> _source,
 	size_t _maxIndex = std::numeric_limits<size_t>::max()
 );
 
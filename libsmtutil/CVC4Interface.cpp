@@ -121,6 +121,18 @@ pair<CheckResult, vector<string>> CVC4Interface::check(vector<Expression> const&
 	return make_pair(result, values);
 }
 
+void CVC4Interface::interrupt()
+{
+	try
+	{
+		m_solver.interrupt();
+	}
+	catch (CVC4::Exception const&)
+	{
+		// Thrown if no query is running.
+	}
+}
+
 CVC4::Expr CVC4Interface::toCVC4Expr(Expression const& _expr)
 {
 	// Variable
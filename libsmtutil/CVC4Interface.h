@@ -51,6 +51,7 @@ public:
 
 	void addAssertion(Expression const& _expr) override;
 	std::pair<CheckResult, std::vector<std::string>> check(std::vector<Expression> const& _expressionsToEvaluate) override;
+	void interrupt() override;
 
 private:
 	CVC4::Expr toCVC4Expr(Expression const& _expr);
@@ -26,6 +26,10 @@
 #endif
 #include <libsmtutil/SMTLib2Interface.h>
 
+#include <libsolutil/Parallel.h>
+
+#include <mutex>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::util;
@@ -36,9 +40,11 @@ SMTPortfolio::SMTPortfolio(
 	map<h256, string> _smtlib2Responses,
 	frontend::ReadCallback::Callback _smtCallback,
 	[[maybe_unused]] SMTSolverChoice _enabledSolvers,
-	optional<unsigned> _queryTimeout
+	optional<unsigned> _queryTimeout,
+	SMTPortfolioStrategy _strategy
 ):
-	SolverInterface(_queryTimeout)
+	SolverInterface(_queryTimeout),
+	m_strategy(_strategy)
 {
 	m_solvers.emplace_back(make_unique<SMTLib2Interface>(move(_smtlib2Responses), move(_smtCallback), m_queryTimeout));
 #ifdef HAVE_Z3
@@ -111,9 +117,17 @@ void SMTPortfolio::addAssertion(Expression const& _expr)
  *   when it is told that this is a hard query to solve.
  *
  *   If all solvers return ERROR, the result is ERROR.
+ *
+ * With the Race strategy, the solvers are queried concurrently instead. The first
+ * solver that answers the query decides the result and the others are interrupted,
+ * so conflicting answers are not detected. If no solver answers, the result is
+ * decided as in 3).
 */
 pair<CheckResult, vector<string>> SMTPortfolio::check(vector<Expression> const& _expressionsToEvaluate)
 {
+	if (m_strategy == SMTPortfolioStrategy::Race && m_solvers.size() > 1)
+		return race(_expressionsToEvaluate);
+
 	CheckResult lastResult = CheckResult::ERROR;
 	vector<string> finalValues;
 	for (auto const& s: m_solvers)
@@ -140,6 +154,51 @@ pair<CheckResult, vector<string>> SMTPortfolio::check(vector<Expression> const&
 	return make_pair(lastResult, finalValues);
 }
 
+void SMTPortfolio::interrupt()
+{
+	for (auto const& s: m_solvers)
+		s->interrupt();
+}
+
+pair<CheckResult, vector<string>> SMTPortfolio::race(vector<Expression> const& _expressionsToEvaluate)
+{
+	vector<pair<CheckResult, vector<string>>> results(m_solvers.size(), {CheckResult::ERROR, {}});
+	optional<size_t> winner;
+	mutex resultMutex;
+
+	vector<exception_ptr> exceptions = util::parallelFor(m_solvers.size(), m_solvers.size(), [&](size_t _index) {
+		// The SMTLib2 interface in position 0 is always queried, so that
+		// the unhandled queries do not depend on which solver was faster.
+		if (_index != 0)
+		{
+			lock_guard<mutex> lock(resultMutex);
+			if (winner)
+				return;
+		}
+		pair<CheckResult, vector<string>> result = m_solvers[_index]->check(_expressionsToEvaluate);
+
+		lock_guard<mutex> lock(resultMutex);
+		if (!winner && solverAnswered(result.first))
+		{
+			winner = _index;
+			for (size_t i = 0; i < m_solvers.size(); ++i)
+				if (i != _index)
+					m_solvers[i]->interrupt();
+		}
+		results[_index] = move(result);
+	});
+	for (exception_ptr const& exception: exceptions)
+		if (exception)
+			rethrow_exception(exception);
+
+	if (winner)
+		return move(results[*winner]);
+	for (auto const& result: results)
+		if (result.first == CheckResult::UNKNOWN)
+			return {CheckResult::UNKNOWN, {}};
+	return {CheckResult::ERROR, {}};
+}
+
 vector<string> SMTPortfolio::unhandledQueries()
 {
 	// This code assumes that the constructor guarantees that
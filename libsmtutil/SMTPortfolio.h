@@ -33,8 +33,9 @@ namespace solidity::smtutil
 /**
  * The SMTPortfolio wraps all available solvers within a single interface,
  * propagating the functionalities to all solvers.
- * It also checks whether different solvers give conflicting answers
- * to SMT queries.
+ * With the CrossCheck strategy, it also checks whether different solvers give
+ * conflicting answers to SMT queries. With the Race strategy, the solvers
+ * run concurrently and the first one to answer a query decides the result.
  */
 class SMTPortfolio: public SolverInterface, public boost::noncopyable
 {
@@ -43,7 +44,8 @@ public:
 		std::map<util::h256, std::string> _smtlib2Responses = {},
 		frontend::ReadCallback::Callback _smtCallback = {},
 		SMTSolverChoice _enabledSolvers = SMTSolverChoice::All(),
-		std::optional<unsigned> _queryTimeout = {}
+		std::optional<unsigned> _queryTimeout = {},
+		SMTPortfolioStrategy _strategy = SMTPortfolioStrategy::CrossCheck
 	);
 
 	void reset() override;
@@ -56,12 +58,18 @@ public:
 	void addAssertion(Expression const& _expr) override;
 
 	std::pair<CheckResult, std::vector<std::string>> check(std::vector<Expression> const& _expressionsToEvaluate) override;
+	void interrupt() override;
 
 	std::vector<std::string> unhandledQueries() override;
 	size_t solvers() override { return m_solvers.size(); }
 private:
 	static bool solverAnswered(CheckResult result);
 
+	/// Runs the query on all solvers concurrently and interrupts the others
+	/// as soon as one of them answers.
+	std::pair<CheckResult, std::vector<std::string>> race(std::vector<Expression> const& _expressionsToEvaluate);
+
+	SMTPortfolioStrategy m_strategy;
 	std::vector<std::unique_ptr<SolverInterface>> m_solvers;
 
 	std::vector<Expression> m_assertions;
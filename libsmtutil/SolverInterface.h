@@ -49,6 +49,15 @@ struct SMTSolverChoice
 	bool all() { return cvc4 && z3; }
 };
 
+/// How SMTPortfolio combines the answers of multiple solvers.
+enum class SMTPortfolioStrategy
+{
+	/// Query the solvers one after another and report conflicting answers.
+	CrossCheck,
+	/// Query the solvers concurrently and use the first satisfiable or unsatisfiable answer.
+	Race
+};
+
 enum class CheckResult
 {
 	SATISFIABLE, UNSATISFIABLE, UNKNOWN, CONFLICTING, ERROR
@@ -399,6 +408,10 @@ public:
 	virtual std::pair<CheckResult, std::vector<std::string>>
 	check(std::vector<Expression> const& _expressionsToEvaluate) = 0;
 
+	/// Asks a check() that is currently running in another thread to return as soon as possible.
+	/// The interrupted check returns UNKNOWN or ERROR. Does nothing if no check is running.
+	virtual void interrupt() {}
+
 	/// @returns a list of queries that the system was not able to respond to.
 	virtual std::vector<std::string> unhandledQueries() { return {}; }
 
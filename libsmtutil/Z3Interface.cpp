@@ -139,6 +139,11 @@ pair<CheckResult, vector<string>> Z3Interface::check(vector<Expression> const& _
 	return make_pair(result, values);
 }
 
+void Z3Interface::interrupt()
+{
+	m_context.interrupt();
+}
+
 z3::expr Z3Interface::toZ3Expr(Expression const& _expr)
 {
 	if (_expr.arguments.empty() && m_constants.count(_expr.name))
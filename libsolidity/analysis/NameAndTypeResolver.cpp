@@ -228,8 +228,20 @@ void NameAndTypeResolver::warnHomonymDeclarations() const
 {
 	DeclarationContainer::Homonyms homonyms;
 	m_scopes.at(nullptr)->populateHomonyms(back_inserter(homonyms));
+	warnHomonymDeclarations(homonyms);
+}
+
+void NameAndTypeResolver::warnHomonymDeclarations(vector<SourceUnit const*> const& _sourceUnits) const
+{
+	DeclarationContainer::Homonyms homonyms;
+	for (SourceUnit const* sourceUnit: _sourceUnits)
+		m_scopes.at(sourceUnit)->populateHomonyms(back_inserter(homonyms));
+	warnHomonymDeclarations(homonyms);
+}
 
-	for (auto [innerLocation, outerDeclarations]: homonyms)
+void NameAndTypeResolver::warnHomonymDeclarations(DeclarationContainer::Homonyms const& _homonyms) const
+{
+	for (auto [innerLocation, outerDeclarations]: _homonyms)
 	{
 		solAssert(innerLocation && !outerDeclarations.empty(), "");
 
@@ -97,6 +97,9 @@ public:
 
 	/// Generate and store warnings about declarations with the same name.
 	void warnHomonymDeclarations() const;
+	/// Generate and store warnings about declarations with the same name,
+	/// only considering declarations inside the given source units.
+	void warnHomonymDeclarations(std::vector<SourceUnit const*> const& _sourceUnits) const;
 
 	/// @returns a list of similar identifiers in the current and enclosing scopes. May return empty string if no suggestions.
 	std::string similarNameSuggestions(ASTString const& _name) const;
@@ -105,6 +108,9 @@ public:
 	void setScope(ASTNode const* _node);
 
 private:
+	/// Reports warnings for the given homonymous declarations.
+	void warnHomonymDeclarations(DeclarationContainer::Homonyms const& _homonyms) const;
+
 	/// Internal version of @a resolveNamesAndTypes (called from there) throws exceptions on fatal errors.
 	bool resolveNamesAndTypesInternal(ASTNode& _node, bool _resolveInsideCode = true);
 
@@ -32,7 +32,6 @@
 #include <liblangutil/SourceLocation.h>
 #include <libevmasm/Instruction.h>
 #include <libsolutil/FixedHash.h>
-#include <libsolutil/LazyInit.h>
 
 #include <boost/noncopyable.hpp>
 #include <json/json.h>
@@ -552,8 +551,8 @@ private:
 	ContractKind m_contractKind;
 	bool m_abstract{false};
 
-	util::LazyInit<std::vector<std::pair<util::FixedHash<4>, FunctionTypePointer>>> m_interfaceFunctionList[2];
-	util::LazyInit<std::vector<EventDefinition const*>> m_interfaceEvents;
+	mutable LazyState<std::vector<std::pair<util::FixedHash<4>, FunctionTypePointer>>> m_interfaceFunctionList[2];
+	mutable LazyState<std::vector<EventDefinition const*>> m_interfaceEvents;
 };
 
 /**
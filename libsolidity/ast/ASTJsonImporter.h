@@ -156,6 +156,8 @@ private:
 	/// filepath to AST
 	std::map<std::string, ASTPointer<SourceUnit>> m_sourceUnits;
 	std::string m_currentSourceName;
+	/// stream carrying the name of the current source unit, shared by all its locations
+	std::shared_ptr<langutil::CharStream> m_currentSource;
 	/// IDs already used by the nodes
 	std::set<int64_t> m_usedIDs;
 	/// Configured EVM version
@@ -21,6 +21,9 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/split.hpp>
 
+#include <mutex>
+#include <shared_mutex>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::frontend;
@@ -29,13 +32,13 @@ using namespace solidity::util;
 BoolType const TypeProvider::m_boolean{};
 InaccessibleDynamicType const TypeProvider::m_inaccessibleDynamic{};
 
-/// The string and bytes unique_ptrs are initialized when they are first used because
+/// The string and bytes types are created when they are first used because
 /// they rely on `byte` being available which we cannot guarantee in the static init context.
-unique_ptr<ArrayType> TypeProvider::m_bytesStorage;
-unique_ptr<ArrayType> TypeProvider::m_bytesMemory;
-unique_ptr<ArrayType> TypeProvider::m_bytesCalldata;
-unique_ptr<ArrayType> TypeProvider::m_stringStorage;
-unique_ptr<ArrayType> TypeProvider::m_stringMemory;
+LazyState<unique_ptr<ArrayType const>> TypeProvider::m_bytesStorage;
+LazyState<unique_ptr<ArrayType const>> TypeProvider::m_bytesMemory;
+LazyState<unique_ptr<ArrayType const>> TypeProvider::m_bytesCalldata;
+LazyState<unique_ptr<ArrayType const>> TypeProvider::m_stringStorage;
+LazyState<unique_ptr<ArrayType const>> TypeProvider::m_stringMemory;
 
 TupleType const TypeProvider::m_emptyTuple{};
 AddressType const TypeProvider::m_payableAddress{StateMutability::Payable};
@@ -154,6 +157,46 @@ array<unique_ptr<MagicType>, 4> const TypeProvider::m_magics{{
 	// MetaType is stored separately
 }};
 
+namespace
+{
+
+/// Guards the maps of shared types. Lookups only take it shared, so that they do not wait for
+/// each other. A type is added while holding it exclusively and Type::LazyStateLock, which
+/// serializes the creation of types. Like the latter, it only locks inside of a concurrent section.
+template <template <typename> class Lock>
+class SharedTypesLock
+{
+public:
+	SharedTypesLock(): m_lock(mutex(), defer_lock)
+	{
+		if (Type::inConcurrentSection())
+			m_lock.lock();
+	}
+
+private:
+	static shared_mutex& mutex()
+	{
+		static shared_mutex sharedTypesMutex;
+		return sharedTypesMutex;
+	}
+
+	Lock<shared_mutex> m_lock;
+};
+
+using TypeLookupLock = SharedTypesLock<shared_lock>;
+using TypeInsertionLock = SharedTypesLock<unique_lock>;
+
+/// @returns the value stored for @a _key in @a _types or nullptr.
+template <typename Map, typename Key>
+auto findType(Map const& _types, Key const& _key)
+{
+	TypeLookupLock lock;
+	auto it = _types.find(_key);
+	return it != _types.end() ? &*it->second : nullptr;
+}
+
+}
+
 inline void clearCache(Type const& type)
 {
 	type.clearCache();
@@ -162,9 +205,7 @@ inline void clearCache(Type const& type)
 template <typename T>
 inline void clearCache(unique_ptr<T> const& type)
 {
-	// Some lazy-initialized types might not exist yet.
-	if (type)
-		type->clearCache();
+	type->clearCache();
 }
 
 template <typename Container>
@@ -178,11 +219,11 @@ void TypeProvider::reset()
 {
 	clearCache(m_boolean);
 	clearCache(m_inaccessibleDynamic);
-	clearCache(m_bytesStorage);
-	clearCache(m_bytesMemory);
-	clearCache(m_bytesCalldata);
-	clearCache(m_stringStorage);
-	clearCache(m_stringMemory);
+	m_bytesStorage.reset();
+	m_bytesMemory.reset();
+	m_bytesCalldata.reset();
+	m_stringStorage.reset();
+	m_stringMemory.reset();
 	clearCache(m_emptyTuple);
 	clearCache(m_payableAddress);
 	clearCache(m_address);
@@ -195,15 +236,48 @@ void TypeProvider::reset()
 	instance().m_stringLiteralTypes.clear();
 	instance().m_ufixedMxN.clear();
 	instance().m_fixedMxN.clear();
+	instance().m_locationTypes.clear();
+	instance().m_tupleTypes.clear();
+	instance().m_byteArrayTypes.clear();
+	instance().m_arrayTypes.clear();
+	instance().m_arraySliceTypes.clear();
+	instance().m_rationalNumberTypes.clear();
+	instance().m_contractTypes.clear();
+	instance().m_enumTypes.clear();
+	instance().m_moduleTypes.clear();
+	instance().m_typeTypes.clear();
+	instance().m_structTypes.clear();
+	instance().m_metaTypes.clear();
+	instance().m_mappingTypes.clear();
 }
 
 template <typename T, typename... Args>
 inline T const* TypeProvider::createAndGet(Args&& ... _args)
 {
+	Type::LazyStateLock lock;
 	instance().m_generalTypes.emplace_back(make_unique<T>(std::forward<Args>(_args)...));
 	return static_cast<T const*>(instance().m_generalTypes.back().get());
 }
 
+template <typename T, typename Key, typename... Args>
+T const* TypeProvider::createOnce(
+	map<Key, T const*>& _types,
+	typename map<Key, T const*>::key_type const& _key,
+	Args&& ... _args
+)
+{
+	if (T const* type = findType(_types, _key))
+		return type;
+	Type::LazyStateLock lock;
+	if (T const* type = findType(_types, _key))
+		return type;
+	// Creating the type can request other types, so the key is only added afterwards.
+	T const* type = createAndGet<T>(std::forward<Args>(_args)...);
+	TypeInsertionLock insertionLock;
+	_types.emplace(_key, type);
+	return type;
+}
+
 Type const* TypeProvider::fromElementaryTypeName(ElementaryTypeNameToken const& _type, std::optional<StateMutability> _stateMutability)
 {
 	solAssert(
@@ -306,37 +380,27 @@ TypePointer TypeProvider::fromElementaryTypeName(string const& _name)
 
 ArrayType const* TypeProvider::bytesStorage()
 {
-	if (!m_bytesStorage)
-		m_bytesStorage = make_unique<ArrayType>(DataLocation::Storage, false);
-	return m_bytesStorage.get();
+	return m_bytesStorage.init([]{ return make_unique<ArrayType const>(DataLocation::Storage, false); }).get();
 }
 
 ArrayType const* TypeProvider::bytesMemory()
 {
-	if (!m_bytesMemory)
-		m_bytesMemory = make_unique<ArrayType>(DataLocation::Memory, false);
-	return m_bytesMemory.get();
+	return m_bytesMemory.init([]{ return make_unique<ArrayType const>(DataLocation::Memory, false); }).get();
 }
 
 ArrayType const* TypeProvider::bytesCalldata()
 {
-	if (!m_bytesCalldata)
-		m_bytesCalldata = make_unique<ArrayType>(DataLocation::CallData, false);
-	return m_bytesCalldata.get();
+	return m_bytesCalldata.init([]{ return make_unique<ArrayType const>(DataLocation::CallData, false); }).get();
 }
 
 ArrayType const* TypeProvider::stringStorage()
 {
-	if (!m_stringStorage)
-		m_stringStorage = make_unique<ArrayType>(DataLocation::Storage, true);
-	return m_stringStorage.get();
+	return m_stringStorage.init([]{ return make_unique<ArrayType const>(DataLocation::Storage, true); }).get();
 }
 
 ArrayType const* TypeProvider::stringMemory()
 {
-	if (!m_stringMemory)
-		m_stringMemory = make_unique<ArrayType>(DataLocation::Memory, true);
-	return m_stringMemory.get();
+	return m_stringMemory.init([]{ return make_unique<ArrayType const>(DataLocation::Memory, true); }).get();
 }
 
 TypePointer TypeProvider::forLiteral(Literal const& _literal)
@@ -378,25 +442,29 @@ RationalNumberType const* TypeProvider::rationalNumber(Literal const& _literal)
 
 StringLiteralType const* TypeProvider::stringLiteral(string const& literal)
 {
-	auto i = instance().m_stringLiteralTypes.find(literal);
-	if (i != instance().m_stringLiteralTypes.end())
-		return i->second.get();
-	else
-		return instance().m_stringLiteralTypes.emplace(literal, make_unique<StringLiteralType>(literal)).first->second.get();
+	auto& types = instance().m_stringLiteralTypes;
+	if (StringLiteralType const* type = findType(types, literal))
+		return type;
+	Type::LazyStateLock lock;
+	if (StringLiteralType const* type = findType(types, literal))
+		return type;
+	auto type = make_unique<StringLiteralType>(literal);
+	TypeInsertionLock insertionLock;
+	return types.emplace(literal, move(type)).first->second.get();
 }
 
 FixedPointType const* TypeProvider::fixedPoint(unsigned m, unsigned n, FixedPointType::Modifier _modifier)
 {
 	auto& map = _modifier == FixedPointType::Modifier::Unsigned ? instance().m_ufixedMxN : instance().m_fixedMxN;
 
-	auto i = map.find(make_pair(m, n));
-	if (i != map.end())
-		return i->second.get();
-
-	return map.emplace(
-		make_pair(m, n),
-		make_unique<FixedPointType>(m, n, _modifier)
-	).first->second.get();
+	if (FixedPointType const* type = findType(map, make_pair(m, n)))
+		return type;
+	Type::LazyStateLock lock;
+	if (FixedPointType const* type = findType(map, make_pair(m, n)))
+		return type;
+	auto type = make_unique<FixedPointType>(m, n, _modifier);
+	TypeInsertionLock insertionLock;
+	return map.emplace(make_pair(m, n), move(type)).first->second.get();
 }
 
 TupleType const* TypeProvider::tuple(vector<Type const*> members)
@@ -404,7 +472,7 @@ TupleType const* TypeProvider::tuple(vector<Type const*> members)
 	if (members.empty())
 		return &m_emptyTuple;
 
-	return createAndGet<TupleType>(move(members));
+	return createOnce(instance().m_tupleTypes, members, members);
 }
 
 ReferenceType const* TypeProvider::withLocation(ReferenceType const* _type, DataLocation _location, bool _isPointer)
@@ -412,8 +480,18 @@ ReferenceType const* TypeProvider::withLocation(ReferenceType const* _type, Data
 	if (_type->location() == _location && _type->isPointer() == _isPointer)
 		return _type;
 
+	auto key = make_tuple(_type, _location, _isPointer);
+	auto& locationTypes = instance().m_locationTypes;
+	if (ReferenceType const* type = findType(locationTypes, key))
+		return type;
+	Type::LazyStateLock lock;
+	if (ReferenceType const* type = findType(locationTypes, key))
+		return type;
 	instance().m_generalTypes.emplace_back(_type->copyForLocation(_location, _isPointer));
-	return static_cast<ReferenceType const*>(instance().m_generalTypes.back().get());
+	auto type = static_cast<ReferenceType const*>(instance().m_generalTypes.back().get());
+	TypeInsertionLock insertionLock;
+	locationTypes.emplace(key, type);
+	return type;
 }
 
 FunctionType const* TypeProvider::function(FunctionDefinition const& _function, FunctionType::Kind _kind)
@@ -483,7 +561,7 @@ FunctionType const* TypeProvider::function(
 
 RationalNumberType const* TypeProvider::rationalNumber(rational const& _value, Type const* _compatibleBytesType)
 {
-	return createAndGet<RationalNumberType>(_value, _compatibleBytesType);
+	return createOnce(instance().m_rationalNumberTypes, make_pair(_value, _compatibleBytesType), _value, _compatibleBytesType);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, bool _isString)
@@ -502,47 +580,47 @@ ArrayType const* TypeProvider::array(DataLocation _location, bool _isString)
 		if (_location == DataLocation::Memory)
 			return bytesMemory();
 	}
-	return createAndGet<ArrayType>(_location, _isString);
+	return createOnce(instance().m_byteArrayTypes, make_pair(_location, _isString), _location, _isString);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, Type const* _baseType)
 {
-	return createAndGet<ArrayType>(_location, _baseType);
+	return createOnce(instance().m_arrayTypes, make_tuple(_location, _baseType, optional<u256>{}), _location, _baseType);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, Type const* _baseType, u256 const& _length)
 {
-	return createAndGet<ArrayType>(_location, _baseType, _length);
+	return createOnce(instance().m_arrayTypes, make_tuple(_location, _baseType, optional<u256>{_length}), _location, _baseType, _length);
 }
 
 ArraySliceType const* TypeProvider::arraySlice(ArrayType const& _arrayType)
 {
-	return createAndGet<ArraySliceType>(_arrayType);
+	return createOnce(instance().m_arraySliceTypes, &_arrayType, _arrayType);
 }
 
 ContractType const* TypeProvider::contract(ContractDefinition const& _contractDef, bool _isSuper)
 {
-	return createAndGet<ContractType>(_contractDef, _isSuper);
+	return createOnce(instance().m_contractTypes, make_pair(&_contractDef, _isSuper), _contractDef, _isSuper);
 }
 
 EnumType const* TypeProvider::enumType(EnumDefinition const& _enumDef)
 {
-	return createAndGet<EnumType>(_enumDef);
+	return createOnce(instance().m_enumTypes, &_enumDef, _enumDef);
 }
 
 ModuleType const* TypeProvider::module(SourceUnit const& _source)
 {
-	return createAndGet<ModuleType>(_source);
+	return createOnce(instance().m_moduleTypes, &_source, _source);
 }
 
 TypeType const* TypeProvider::typeType(Type const* _actualType)
 {
-	return createAndGet<TypeType>(_actualType);
+	return createOnce(instance().m_typeTypes, _actualType, _actualType);
 }
 
 StructType const* TypeProvider::structType(StructDefinition const& _struct, DataLocation _location)
 {
-	return createAndGet<StructType>(_struct, _location);
+	return createOnce(instance().m_structTypes, make_pair(&_struct, _location), _struct, _location);
 }
 
 ModifierType const* TypeProvider::modifier(ModifierDefinition const& _def)
@@ -565,10 +643,10 @@ MagicType const* TypeProvider::meta(Type const* _type)
 		),
 		"Only contracts or integer types supported for now."
 	);
-	return createAndGet<MagicType>(_type);
+	return createOnce(instance().m_metaTypes, _type, _type);
 }
 
 MappingType const* TypeProvider::mapping(Type const* _keyType, Type const* _valueType)
 {
-	return createAndGet<MappingType>(_keyType, _valueType);
+	return createOnce(instance().m_mappingTypes, make_pair(_keyType, _valueType), _keyType, _valueType);
 }
@@ -24,7 +24,9 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 namespace solidity::frontend
 {
@@ -37,6 +39,16 @@ namespace solidity::frontend
  *
  * It is not recommended to explicitly instantiate types unless you really know what and why
  * you are doing it.
+ *
+ * Types that are fully determined by the arguments of the factory function (e.g. arrays,
+ * mappings, tuples or types with a different data location) are created only once for every
+ * combination of arguments, so equal types requested repeatedly share one instance.
+ * Function and modifier types depend on the annotations of their declarations, which are
+ * only available later, so they are created anew on every request.
+ *
+ * Contract, struct, enum and module types are shared by the address of their AST node. The AST
+ * therefore has to stay alive until the next call to reset(), otherwise a node allocated at the
+ * same address would get the type of the destroyed one.
  */
 class TypeProvider
 {
@@ -50,6 +62,7 @@ public:
 
 	/// Resets state of this TypeProvider to initial state, wiping all mutable types.
 	/// This invalidates all dangling pointers to types provided by this TypeProvider.
+	/// Has to be called before the AST nodes the types refer to are destroyed.
 	static void reset();
 
 	/// @name Factory functions
@@ -210,15 +223,23 @@ private:
 	template <typename T, typename... Args>
 	static inline T const* createAndGet(Args&& ... _args);
 
+	/// @returns the type stored for @a _key in @a _types, or creates it from @a _args and stores it.
+	template <typename T, typename Key, typename... Args>
+	static T const* createOnce(
+		std::map<Key, T const*>& _types,
+		typename std::map<Key, T const*>::key_type const& _key,
+		Args&& ... _args
+	);
+
 	static BoolType const m_boolean;
 	static InaccessibleDynamicType const m_inaccessibleDynamic;
 
 	/// These are lazy-initialized because they depend on `byte` being available.
-	static std::unique_ptr<ArrayType> m_bytesStorage;
-	static std::unique_ptr<ArrayType> m_bytesMemory;
-	static std::unique_ptr<ArrayType> m_bytesCalldata;
-	static std::unique_ptr<ArrayType> m_stringStorage;
-	static std::unique_ptr<ArrayType> m_stringMemory;
+	static LazyState<std::unique_ptr<ArrayType const>> m_bytesStorage;
+	static LazyState<std::unique_ptr<ArrayType const>> m_bytesMemory;
+	static LazyState<std::unique_ptr<ArrayType const>> m_bytesCalldata;
+	static LazyState<std::unique_ptr<ArrayType const>> m_stringStorage;
+	static LazyState<std::unique_ptr<ArrayType const>> m_stringMemory;
 
 	static TupleType const m_emptyTuple;
 	static AddressType const m_payableAddress;
@@ -232,6 +253,21 @@ private:
 	std::map<std::pair<unsigned, unsigned>, std::unique_ptr<FixedPointType>> m_fixedMxN{};
 	std::map<std::string, std::unique_ptr<StringLiteralType>> m_stringLiteralTypes{};
 	std::vector<std::unique_ptr<Type>> m_generalTypes{};
+
+	/// Shared instances of the types in m_generalTypes, keyed by the factory arguments.
+	std::map<std::tuple<ReferenceType const*, DataLocation, bool>, ReferenceType const*> m_locationTypes{};
+	std::map<std::vector<Type const*>, TupleType const*> m_tupleTypes{};
+	std::map<std::pair<DataLocation, bool>, ArrayType const*> m_byteArrayTypes{};
+	std::map<std::tuple<DataLocation, Type const*, std::optional<u256>>, ArrayType const*> m_arrayTypes{};
+	std::map<ArrayType const*, ArraySliceType const*> m_arraySliceTypes{};
+	std::map<std::pair<rational, Type const*>, RationalNumberType const*> m_rationalNumberTypes{};
+	std::map<std::pair<ContractDefinition const*, bool>, ContractType const*> m_contractTypes{};
+	std::map<EnumDefinition const*, EnumType const*> m_enumTypes{};
+	std::map<SourceUnit const*, ModuleType const*> m_moduleTypes{};
+	std::map<Type const*, TypeType const*> m_typeTypes{};
+	std::map<std::pair<StructDefinition const*, DataLocation>, StructType const*> m_structTypes{};
+	std::map<Type const*, MagicType const*> m_metaTypes{};
+	std::map<std::pair<Type const*, Type const*>, MappingType const*> m_mappingTypes{};
 };
 
 }
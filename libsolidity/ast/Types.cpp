@@ -113,7 +113,8 @@ util::Result<TypePointers> transformParametersToExternal(TypePointers const& _pa
 
 void Type::clearCache() const
 {
-	m_members.clear();
+	m_members.store(nullptr, memory_order_relaxed);
+	m_memberLists.reset();
 	m_stackItems.reset();
 	m_stackSize.reset();
 }
@@ -250,15 +251,32 @@ string Type::escapeIdentifier(string const& _identifier)
 	return ret;
 }
 
-string Type::identifier() const
+string const& Type::richIdentifier() const
 {
-	string ret = escapeIdentifier(richIdentifier());
-	solAssert(ret.find_first_of("0123456789") != 0, "Identifier cannot start with a number.");
-	solAssert(
-		ret.find_first_not_of("0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMONPQRSTUVWXYZ_$") == string::npos,
-		"Identifier contains invalid characters."
-	);
-	return ret;
+	return m_richIdentifier.init([&]{ return makeRichIdentifier(); });
+}
+
+string const& Type::identifier() const
+{
+	return m_identifier.init([&]{
+		string ret = escapeIdentifier(richIdentifier());
+		solAssert(ret.find_first_of("0123456789") != 0, "Identifier cannot start with a number.");
+		solAssert(
+			ret.find_first_not_of("0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMONPQRSTUVWXYZ_$") == string::npos,
+			"Identifier contains invalid characters."
+		);
+		return ret;
+	});
+}
+
+string const& Type::toString(bool _short) const
+{
+	return (_short ? m_shortName : m_longName).init([&]{ return makeToString(_short); });
+}
+
+string const& Type::canonicalName() const
+{
+	return m_canonicalName.init([&]{ return makeCanonicalName(); });
 }
 
 TypePointer Type::commonType(Type const* _a, Type const* _b)
@@ -273,21 +291,48 @@ TypePointer Type::commonType(Type const* _a, Type const* _b)
 		return nullptr;
 }
 
+recursive_mutex& Type::lazyStateMutex()
+{
+	static recursive_mutex mutex;
+	return mutex;
+}
+
+atomic<unsigned>& Type::concurrentSections()
+{
+	static atomic<unsigned> sections{0};
+	return sections;
+}
+
 MemberList const& Type::members(ASTNode const* _currentScope) const
 {
-	if (!m_members[_currentScope])
-	{
-		solAssert(
-			_currentScope == nullptr ||
-			dynamic_cast<SourceUnit const*>(_currentScope) ||
-			dynamic_cast<ContractDefinition const*>(_currentScope),
-		"");
-		MemberList::MemberMap members = nativeMembers(_currentScope);
-		if (_currentScope)
-			members += boundFunctions(*this, *_currentScope);
-		m_members[_currentScope] = make_unique<MemberList>(move(members));
-	}
-	return *m_members[_currentScope];
+	auto findMembers = [&]() -> MemberList const* {
+		for (ScopeMembers const* entry = m_members.load(memory_order_acquire); entry; entry = entry->next.get())
+			if (entry->scope == _currentScope)
+				return &entry->members;
+		return nullptr;
+	};
+	if (MemberList const* members = findMembers())
+		return *members;
+
+	LazyStateLock lock;
+	if (MemberList const* members = findMembers())
+		return *members;
+	solAssert(
+		_currentScope == nullptr ||
+		dynamic_cast<SourceUnit const*>(_currentScope) ||
+		dynamic_cast<ContractDefinition const*>(_currentScope),
+	"");
+	MemberList::MemberMap members = nativeMembers(_currentScope);
+	if (_currentScope)
+		members += boundFunctions(*this, *_currentScope);
+	// Computing the members can request the members of this type in the same scope.
+	if (MemberList const* existingMembers = findMembers())
+		return *existingMembers;
+	m_memberLists = make_unique<ScopeMembers const>(
+		ScopeMembers{_currentScope, MemberList(move(members)), move(m_memberLists)}
+	);
+	m_members.store(m_memberLists.get(), memory_order_release);
+	return m_memberLists->members;
 }
 
 TypePointer Type::fullEncodingType(bool _inLibraryCall, bool _encoderV2, bool) const
@@ -378,7 +423,7 @@ AddressType::AddressType(StateMutability _stateMutability):
 	solAssert(m_stateMutability == StateMutability::Payable || m_stateMutability == StateMutability::NonPayable, "");
 }
 
-string AddressType::richIdentifier() const
+string AddressType::makeRichIdentifier() const
 {
 	if (m_stateMutability == StateMutability::Payable)
 		return "t_address_payable";
@@ -412,7 +457,7 @@ BoolResult AddressType::isExplicitlyConvertibleTo(Type const& _convertTo) const
 	return false;
 }
 
-string AddressType::toString(bool) const
+string AddressType::makeToString(bool) const
 {
 	if (m_stateMutability == StateMutability::Payable)
 		return "address payable";
@@ -420,7 +465,7 @@ string AddressType::toString(bool) const
 		return "address";
 }
 
-string AddressType::canonicalName() const
+string AddressType::makeCanonicalName() const
 {
 	return "address";
 }
@@ -500,7 +545,7 @@ IntegerType::IntegerType(unsigned _bits, IntegerType::Modifier _modifier):
 	);
 }
 
-string IntegerType::richIdentifier() const
+string IntegerType::makeRichIdentifier() const
 {
 	return "t_" + string(isSigned() ? "" : "u") + "int" + to_string(numBits());
 }
@@ -570,7 +615,7 @@ bool IntegerType::operator==(Type const& _other) const
 	return other.m_bits == m_bits && other.m_modifier == m_modifier;
 }
 
-string IntegerType::toString(bool) const
+string IntegerType::makeToString(bool) const
 {
 	string prefix = isSigned() ? "int" : "uint";
 	return prefix + util::toString(m_bits);
@@ -667,7 +712,7 @@ FixedPointType::FixedPointType(unsigned _totalBits, unsigned _fractionalDigits,
 	);
 }
 
-string FixedPointType::richIdentifier() const
+string FixedPointType::makeRichIdentifier() const
 {
 	return "t_" + string(isSigned() ? "" : "u") + "fixed" + to_string(m_totalBits) + "x" + to_string(m_fractionalDigits);
 }
@@ -718,7 +763,7 @@ bool FixedPointType::operator==(Type const& _other) const
 	return other.m_totalBits == m_totalBits && other.m_fractionalDigits == m_fractionalDigits && other.m_modifier == m_modifier;
 }
 
-string FixedPointType::toString(bool) const
+string FixedPointType::makeToString(bool) const
 {
 	string prefix = isSigned() ? "fixed" : "ufixed";
 	return prefix + util::toString(m_totalBits) + "x" + util::toString(m_fractionalDigits);
@@ -1035,7 +1080,7 @@ TypeResult RationalNumberType::binaryOperatorResult(Token _operator, Type const*
 		return nullptr;
 }
 
-string RationalNumberType::richIdentifier() const
+string RationalNumberType::makeRichIdentifier() const
 {
 	// rational seemingly will put the sign always on the numerator,
 	// but let just make it deterministic here.
@@ -1066,7 +1111,7 @@ string RationalNumberType::bigintToReadableString(bigint const& _num)
 	return str;
 }
 
-string RationalNumberType::toString(bool) const
+string RationalNumberType::makeToString(bool) const
 {
 	if (!isFractional())
 		return "int_const " + bigintToReadableString(m_value.numerator());
@@ -1203,7 +1248,7 @@ BoolResult StringLiteralType::isImplicitlyConvertibleTo(Type const& _convertTo)
 		return false;
 }
 
-string StringLiteralType::richIdentifier() const
+string StringLiteralType::makeRichIdentifier() const
 {
 	// Since we have to return a valid identifier and the string itself may contain
 	// anything, we hash it.
@@ -1217,7 +1262,7 @@ bool StringLiteralType::operator==(Type const& _other) const
 	return m_value == dynamic_cast<StringLiteralType const&>(_other).m_value;
 }
 
-std::string StringLiteralType::toString(bool) const
+std::string StringLiteralType::makeToString(bool) const
 {
 	auto isPrintableASCII = [](string const& s)
 	{
@@ -1308,7 +1353,7 @@ MemberList::MemberMap FixedBytesType::nativeMembers(ASTNode const*) const
 	return MemberList::MemberMap{MemberList::Member{"length", TypeProvider::uint(8)}};
 }
 
-string FixedBytesType::richIdentifier() const
+string FixedBytesType::makeRichIdentifier() const
 {
 	return "t_bytes" + to_string(m_bytes);
 }
@@ -1570,7 +1615,7 @@ BoolResult ArrayType::isExplicitlyConvertibleTo(Type const& _convertTo) const
 	return true;
 }
 
-string ArrayType::richIdentifier() const
+string ArrayType::makeRichIdentifier() const
 {
 	string id;
 	if (isString())
@@ -1593,6 +1638,9 @@ string ArrayType::richIdentifier() const
 
 bool ArrayType::operator==(Type const& _other) const
 {
+	// Equal types usually share one instance, see TypeProvider.
+	if (this == &_other)
+		return true;
 	if (_other.category() != category())
 		return false;
 	ArrayType const& other = dynamic_cast<ArrayType const&>(_other);
@@ -1736,7 +1784,7 @@ vector<tuple<string, TypePointer>> ArrayType::makeStackItems() const
 	solAssert(false, "");
 }
 
-string ArrayType::toString(bool _short) const
+string ArrayType::makeToString(bool _short) const
 {
 	string ret;
 	if (isString())
@@ -1755,7 +1803,7 @@ string ArrayType::toString(bool _short) const
 	return ret;
 }
 
-string ArrayType::canonicalName() const
+string ArrayType::makeCanonicalName() const
 {
 	string ret;
 	if (isString())
@@ -1839,35 +1887,26 @@ TypePointer ArrayType::decodingType() const
 
 TypeResult ArrayType::interfaceType(bool _inLibrary) const
 {
-	if (_inLibrary && m_interfaceType_library.has_value())
-		return *m_interfaceType_library;
-
-	if (!_inLibrary && m_interfaceType.has_value())
-		return *m_interfaceType;
-
-	TypeResult result{TypePointer{}};
-	TypeResult baseInterfaceType = m_baseType->interfaceType(_inLibrary);
+	return (_inLibrary ? m_interfaceType_library : m_interfaceType).init([&]{
+		TypeResult result{TypePointer{}};
+		TypeResult baseInterfaceType = m_baseType->interfaceType(_inLibrary);
 
-	if (!baseInterfaceType.get())
-	{
-		solAssert(!baseInterfaceType.message().empty(), "Expected detailed error message!");
-		result = baseInterfaceType;
-	}
-	else if (_inLibrary && location() == DataLocation::Storage)
-		result = this;
-	else if (m_arrayKind != ArrayKind::Ordinary)
-		result = TypeProvider::withLocation(this, DataLocation::Memory, true);
-	else if (isDynamicallySized())
-		result = TypeProvider::array(DataLocation::Memory, baseInterfaceType);
-	else
-		result = TypeProvider::array(DataLocation::Memory, baseInterfaceType, m_length);
-
-	if (_inLibrary)
-		m_interfaceType_library = result;
-	else
-		m_interfaceType = result;
+		if (!baseInterfaceType.get())
+		{
+			solAssert(!baseInterfaceType.message().empty(), "Expected detailed error message!");
+			result = baseInterfaceType;
+		}
+		else if (_inLibrary && location() == DataLocation::Storage)
+			result = this;
+		else if (m_arrayKind != ArrayKind::Ordinary)
+			result = TypeProvider::withLocation(this, DataLocation::Memory, true);
+		else if (isDynamicallySized())
+			result = TypeProvider::array(DataLocation::Memory, baseInterfaceType);
+		else
+			result = TypeProvider::array(DataLocation::Memory, baseInterfaceType, m_length);
 
-	return result;
+		return result;
+	});
 }
 
 Type const* ArrayType::finalBaseType(bool _breakIfDynamicArrayType) const
@@ -1917,7 +1956,7 @@ BoolResult ArraySliceType::isImplicitlyConvertibleTo(Type const& _other) const
 		);
 }
 
-string ArraySliceType::richIdentifier() const
+string ArraySliceType::makeRichIdentifier() const
 {
 	return m_arrayType.richIdentifier() + "_slice";
 }
@@ -1929,7 +1968,7 @@ bool ArraySliceType::operator==(Type const& _other) const
 	return false;
 }
 
-string ArraySliceType::toString(bool _short) const
+string ArraySliceType::makeToString(bool _short) const
 {
 	return m_arrayType.toString(_short) + " slice";
 }
@@ -1952,7 +1991,7 @@ std::vector<std::tuple<std::string, TypePointer>> ArraySliceType::makeStackItems
 	return {{"offset", TypeProvider::uint256()}, {"length", TypeProvider::uint256()}};
 }
 
-string ContractType::richIdentifier() const
+string ContractType::makeRichIdentifier() const
 {
 	return (m_super ? "t_super" : "t_contract") + parenthesizeUserIdentifier(m_contract.name()) + to_string(m_contract.id());
 }
@@ -1965,7 +2004,7 @@ bool ContractType::operator==(Type const& _other) const
 	return other.m_contract == m_contract && other.m_super == m_super;
 }
 
-string ContractType::toString(bool) const
+string ContractType::makeToString(bool) const
 {
 	return
 		string(m_contract.isLibrary() ? "library " : "contract ") +
@@ -1973,7 +2012,7 @@ string ContractType::toString(bool) const
 		m_contract.name();
 }
 
-string ContractType::canonicalName() const
+string ContractType::makeCanonicalName() const
 {
 	return *m_contract.annotation().canonicalName;
 }
@@ -1995,9 +2034,7 @@ MemberList::MemberMap ContractType::nativeMembers(ASTNode const*) const
 
 FunctionType const* ContractType::newExpressionType() const
 {
-	if (!m_constructorType)
-		m_constructorType = FunctionType::newExpressionType(m_contract);
-	return m_constructorType;
+	return m_constructorType.init([&]{ return FunctionType::newExpressionType(m_contract); });
 }
 
 vector<tuple<VariableDeclaration const*, u256, unsigned>> ContractType::stateVariables() const
@@ -2067,7 +2104,7 @@ BoolResult StructType::isImplicitlyConvertibleTo(Type const& _convertTo) const
 	return this->m_struct == convertTo.m_struct;
 }
 
-string StructType::richIdentifier() const
+string StructType::makeRichIdentifier() const
 {
 	return "t_struct" + parenthesizeUserIdentifier(m_struct.name()) + to_string(m_struct.id()) + identifierLocationSuffix();
 }
@@ -2196,7 +2233,7 @@ bool StructType::containsNestedMapping() const
 	return m_struct.annotation().containsNestedMapping.value();
 }
 
-string StructType::toString(bool _short) const
+string StructType::makeToString(bool _short) const
 {
 	string ret = "struct " + *m_struct.annotation().canonicalName;
 	if (!_short)
@@ -2224,39 +2261,25 @@ MemberList::MemberMap StructType::nativeMembers(ASTNode const*) const
 TypeResult StructType::interfaceType(bool _inLibrary) const
 {
 	if (!_inLibrary)
-	{
-		if (!m_interfaceType.has_value())
-		{
+		return m_interfaceType.init([&]() -> TypeResult {
 			if (recursive())
-				m_interfaceType = TypeResult::err("Recursive type not allowed for public or external contract functions.");
-			else
+				return TypeResult::err("Recursive type not allowed for public or external contract functions.");
+			for (ASTPointer<VariableDeclaration> const& member: m_struct.members())
 			{
-				TypeResult result{TypePointer{}};
-				for (ASTPointer<VariableDeclaration> const& member: m_struct.members())
+				if (!member->annotation().type)
+					return TypeResult::err("Invalid type!");
+				auto interfaceType = member->annotation().type->interfaceType(false);
+				if (!interfaceType.get())
 				{
-					if (!member->annotation().type)
-					{
-						result = TypeResult::err("Invalid type!");
-						break;
-					}
-					auto interfaceType = member->annotation().type->interfaceType(false);
-					if (!interfaceType.get())
-					{
-						solAssert(!interfaceType.message().empty(), "Expected detailed error message!");
-						result = interfaceType;
-						break;
-					}
+					solAssert(!interfaceType.message().empty(), "Expected detailed error message!");
+					return interfaceType;
 				}
-				if (result.message().empty())
-					m_interfaceType = TypeProvider::withLocation(this, DataLocation::Memory, true);
-				else
-					m_interfaceType = result;
 			}
-		}
-		return *m_interfaceType;
-	}
-	else if (m_interfaceType_library.has_value())
-		return *m_interfaceType_library;
+			return TypeProvider::withLocation(this, DataLocation::Memory, true);
+		});
+
+	if (TypeResult const* interfaceType = m_interfaceType_library.get())
+		return *interfaceType;
 
 	TypeResult result{TypePointer{}};
 
@@ -2317,11 +2340,12 @@ TypeResult StructType::interfaceType(bool _inLibrary) const
 	if (!result.message().empty())
 		return result;
 
-	if (location() == DataLocation::Storage)
-		m_interfaceType_library = this;
-	else
-		m_interfaceType_library = TypeProvider::withLocation(this, DataLocation::Memory, true);
-	return *m_interfaceType_library;
+	return m_interfaceType_library.init([&]() -> TypeResult {
+		if (location() == DataLocation::Storage)
+			return this;
+		else
+			return TypeProvider::withLocation(this, DataLocation::Memory, true);
+	});
 }
 
 BoolResult StructType::validForLocation(DataLocation _loc) const
@@ -2375,7 +2399,7 @@ string StructType::signatureInExternalFunction(bool _structsByName) const
 	}
 }
 
-string StructType::canonicalName() const
+string StructType::makeCanonicalName() const
 {
 	return *m_struct.annotation().canonicalName;
 }
@@ -2461,7 +2485,7 @@ TypeResult EnumType::unaryOperatorResult(Token _operator) const
 	return _operator == Token::Delete ? TypeProvider::emptyTuple() : nullptr;
 }
 
-string EnumType::richIdentifier() const
+string EnumType::makeRichIdentifier() const
 {
 	return "t_enum" + parenthesizeUserIdentifier(m_enum.name()) + to_string(m_enum.id());
 }
@@ -2480,12 +2504,12 @@ unsigned EnumType::storageBytes() const
 	return 1;
 }
 
-string EnumType::toString(bool) const
+string EnumType::makeToString(bool) const
 {
 	return string("enum ") + *m_enum.annotation().canonicalName;
 }
 
-string EnumType::canonicalName() const
+string EnumType::makeCanonicalName() const
 {
 	return *m_enum.annotation().canonicalName;
 }
@@ -2536,7 +2560,7 @@ BoolResult TupleType::isImplicitlyConvertibleTo(Type const& _other) const
 		return false;
 }
 
-string TupleType::richIdentifier() const
+string TupleType::makeRichIdentifier() const
 {
 	return "t_tuple" + identifierList(components());
 }
@@ -2549,7 +2573,7 @@ bool TupleType::operator==(Type const& _other) const
 		return false;
 }
 
-string TupleType::toString(bool _short) const
+string TupleType::makeToString(bool _short) const
 {
 	if (components().empty())
 		return "tuple()";
@@ -2834,7 +2858,7 @@ TypePointers const& FunctionType::parameterTypesIncludingSelf() const
 	return m_parameterTypes;
 }
 
-string FunctionType::richIdentifier() const
+string FunctionType::makeRichIdentifier() const
 {
 	string id = "t_function_";
 	switch (m_kind)
@@ -2891,6 +2915,9 @@ string FunctionType::richIdentifier() const
 
 bool FunctionType::operator==(Type const& _other) const
 {
+	// Equal types usually share one instance, see TypeProvider.
+	if (this == &_other)
+		return true;
 	if (_other.category() != category())
 		return false;
 	FunctionType const& other = dynamic_cast<FunctionType const&>(_other);
@@ -2960,13 +2987,13 @@ TypeResult FunctionType::binaryOperatorResult(Token _operator, Type const* _othe
 	return nullptr;
 }
 
-string FunctionType::canonicalName() const
+string FunctionType::makeCanonicalName() const
 {
 	solAssert(m_kind == Kind::External, "");
 	return "function";
 }
 
-string FunctionType::toString(bool _short) const
+string FunctionType::makeToString(bool _short) const
 {
 	string name = "function ";
 	if (m_kind == Kind::Declaration)
@@ -3578,25 +3605,28 @@ Type const* MappingType::encodingType() const
 	return TypeProvider::integer(256, IntegerType::Modifier::Unsigned);
 }
 
-string MappingType::richIdentifier() const
+string MappingType::makeRichIdentifier() const
 {
 	return "t_mapping" + identifierList(m_keyType, m_valueType);
 }
 
 bool MappingType::operator==(Type const& _other) const
 {
+	// Equal types usually share one instance, see TypeProvider.
+	if (this == &_other)
+		return true;
 	if (_other.category() != category())
 		return false;
 	MappingType const& other = dynamic_cast<MappingType const&>(_other);
 	return *other.m_keyType == *m_keyType && *other.m_valueType == *m_valueType;
 }
 
-string MappingType::toString(bool _short) const
+string MappingType::makeToString(bool _short) const
 {
 	return "mapping(" + keyType()->toString(_short) + " => " + valueType()->toString(_short) + ")";
 }
 
-string MappingType::canonicalName() const
+string MappingType::makeCanonicalName() const
 {
 	return "mapping(" + keyType()->canonicalName() + " => " + valueType()->canonicalName() + ")";
 }
@@ -3624,13 +3654,16 @@ TypeResult MappingType::interfaceType(bool _inLibrary) const
 	return this;
 }
 
-string TypeType::richIdentifier() const
+string TypeType::makeRichIdentifier() const
 {
 	return "t_type" + identifierList(actualType());
 }
 
 bool TypeType::operator==(Type const& _other) const
 {
+	// Equal types usually share one instance, see TypeProvider.
+	if (this == &_other)
+		return true;
 	if (_other.category() != category())
 		return false;
 	TypeType const& other = dynamic_cast<TypeType const&>(_other);
@@ -3753,7 +3786,7 @@ u256 ModifierType::storageSize() const
 	solAssert(false, "Storage size of non-storable type type requested.");
 }
 
-string ModifierType::richIdentifier() const
+string ModifierType::makeRichIdentifier() const
 {
 	return "t_modifier" + identifierList(m_parameterTypes);
 }
@@ -3778,7 +3811,7 @@ bool ModifierType::operator==(Type const& _other) const
 	return true;
 }
 
-string ModifierType::toString(bool _short) const
+string ModifierType::makeToString(bool _short) const
 {
 	string name = "modifier (";
 	for (auto it = m_parameterTypes.begin(); it != m_parameterTypes.end(); ++it)
@@ -3786,7 +3819,7 @@ string ModifierType::toString(bool _short) const
 	return name + ")";
 }
 
-string ModuleType::richIdentifier() const
+string ModuleType::makeRichIdentifier() const
 {
 	return "t_module_" + to_string(m_sourceUnit.id());
 }
@@ -3807,12 +3840,12 @@ MemberList::MemberMap ModuleType::nativeMembers(ASTNode const*) const
 	return symbols;
 }
 
-string ModuleType::toString(bool) const
+string ModuleType::makeToString(bool) const
 {
 	return string("module \"") + *m_sourceUnit.annotation().path + string("\"");
 }
 
-string MagicType::richIdentifier() const
+string MagicType::makeRichIdentifier() const
 {
 	switch (m_kind)
 	{
@@ -3953,7 +3986,7 @@ MemberList::MemberMap MagicType::nativeMembers(ASTNode const*) const
 	return {};
 }
 
-string MagicType::toString(bool _short) const
+string MagicType::makeToString(bool _short) const
 {
 	switch (m_kind)
 	{
@@ -30,13 +30,14 @@
 
 #include <libsolutil/Common.h>
 #include <libsolutil/CommonIO.h>
-#include <libsolutil/LazyInit.h>
 #include <libsolutil/Result.h>
 
 #include <boost/rational.hpp>
 
+#include <atomic>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
@@ -72,6 +73,45 @@ inline rational makeRational(bigint const& _numerator, bigint const& _denominato
 
 enum class DataLocation { Storage, CallData, Memory };
 
+/**
+ * A value of a type (or of a related AST node) that is computed on first use. The computation is
+ * guarded by Type::LazyStateLock, but once the value is computed, it is read without locking.
+ */
+template <typename T>
+class LazyState
+{
+public:
+	LazyState() = default;
+	/// Must not be called inside of a concurrent section, like reset().
+	LazyState(LazyState&& _other) noexcept:
+		m_value(std::move(_other.m_value)),
+		m_ready(_other.m_ready.load(std::memory_order_relaxed))
+	{
+		_other.reset();
+	}
+
+	/// @returns the value, computing it by calling @a _compute if this is the first request.
+	template <typename F>
+	T const& init(F&& _compute);
+
+	/// @returns the value if it was already computed or nullptr otherwise.
+	T const* get() const
+	{
+		return m_ready.load(std::memory_order_acquire) ? &*m_value : nullptr;
+	}
+
+	/// Forgets the value. Must not be called inside of a concurrent section.
+	void reset()
+	{
+		m_value.reset();
+		m_ready.store(false, std::memory_order_relaxed);
+	}
+
+private:
+	std::optional<T> m_value;
+	/// Set after m_value was assigned. Readers that see it set can read m_value without locking.
+	std::atomic<bool> m_ready{false};
+};
 
 /**
  * Helper class to compute storage offsets of members of structs and contracts.
@@ -149,7 +189,7 @@ private:
 	StorageOffsets const& storageOffsets() const;
 
 	MemberMap m_memberTypes;
-	util::LazyInit<StorageOffsets> m_storageOffsets;
+	mutable LazyState<StorageOffsets> m_storageOffsets;
 };
 
 static_assert(std::is_nothrow_move_constructible<MemberList>::value, "MemberList should be noexcept move constructible");
@@ -183,12 +223,14 @@ public:
 	/// only if they have the same identifier.
 	/// The identifier should start with "t_".
 	/// Can contain characters which are invalid in identifiers.
-	virtual std::string richIdentifier() const = 0;
+	/// Computed on first use.
+	std::string const& richIdentifier() const;
 	/// @returns a valid solidity identifier such that two types should compare equal if and
 	/// only if they have the same identifier.
 	/// The identifier should start with "t_".
 	/// Will not contain any character which would be invalid as an identifier.
-	std::string identifier() const;
+	/// Computed on first use.
+	std::string const& identifier() const;
 
 	/// More complex identifier strings use "parentheses", where $_ is interpreted as
 	/// "opening parenthesis", _$ as "closing parenthesis", _$_ as "comma" and any $ that
@@ -289,25 +331,21 @@ public:
 	/// - Each named stack item is typed and contributes the stack slots given by the stack items of its type.
 	std::vector<std::tuple<std::string, TypePointer>> const& stackItems() const
 	{
-		if (!m_stackItems)
-			m_stackItems = makeStackItems();
-		return *m_stackItems;
+		return m_stackItems.init([&]{ return makeStackItems(); });
 	}
 	/// Total number of stack slots occupied by this type. This is the sum of ``sizeOnStack`` of all ``stackItems()``.
 	// TODO: consider changing the return type to be size_t
 	unsigned sizeOnStack() const
 	{
-		if (!m_stackSize)
-		{
+		return static_cast<unsigned>(m_stackSize.init([&]{
 			size_t sizeOnStack = 0;
 			for (auto const& slot: stackItems())
 				if (std::get<1>(slot))
 					sizeOnStack += std::get<1>(slot)->sizeOnStack();
 				else
 					++sizeOnStack;
-			m_stackSize = sizeOnStack;
-		}
-		return static_cast<unsigned>(*m_stackSize);
+			return sizeOnStack;
+		}));
 	}
 	/// If it is possible to initialize such a value in memory by just writing zeros
 	/// of the size memoryHeadSize().
@@ -337,10 +375,12 @@ public:
 		return members(_currentScope).memberType(_name);
 	}
 
-	virtual std::string toString(bool _short) const = 0;
-	std::string toString() const { return toString(false); }
+	/// @returns a human-readable name of this type, computed on first use.
+	std::string const& toString(bool _short) const;
+	std::string const& toString() const { return toString(false); }
 	/// @returns the canonical name of this type for use in library function signatures.
-	virtual std::string canonicalName() const { return toString(true); }
+	/// Computed on first use.
+	std::string const& canonicalName() const;
 	/// @returns the signature of this type in external functions, i.e. `uint256` for integers
 	/// or `(uint256,bytes8)[2]` for an array of structs. If @a _structsByName,
 	/// structs are given by canonical name like `ContractName.StructName[2]`.
@@ -374,7 +414,43 @@ public:
 	/// Clears all internally cached values (if any).
 	virtual void clearCache() const;
 
+	/// Marks a section in which types are used from several threads, i.e. analysis steps or
+	/// the code generator run concurrently. It has to be entered before the threads start and
+	/// left after they finished.
+	class ConcurrentSection
+	{
+	public:
+		ConcurrentSection() { ++concurrentSections(); }
+		~ConcurrentSection() { --concurrentSections(); }
+		ConcurrentSection(ConcurrentSection const&) = delete;
+		ConcurrentSection& operator=(ConcurrentSection const&) = delete;
+	};
+
+	/// Guards the computation of values of types that are computed on first use (members,
+	/// stack items, interface types, ...) and the creation of types in the TypeProvider. It only
+	/// locks inside of a concurrent section, so that serial compilation does not pay for it.
+	/// Values that were already computed are read without taking it.
+	class LazyStateLock
+	{
+	public:
+		LazyStateLock(): m_lock(lazyStateMutex(), std::defer_lock)
+		{
+			if (concurrentSections() > 0)
+				m_lock.lock();
+		}
+
+	private:
+		std::unique_lock<std::recursive_mutex> m_lock;
+	};
+
+	/// @returns true if a concurrent section is entered.
+	static bool inConcurrentSection() { return concurrentSections() > 0; }
+
 private:
+	static std::recursive_mutex& lazyStateMutex();
+	/// Number of concurrent sections that are currently entered.
+	static std::atomic<unsigned>& concurrentSections();
+
 	/// @returns a member list containing all members added to this type by `using for` directives.
 	static MemberList::MemberMap boundFunctions(Type const& _type, ASTNode const& _scope);
 
@@ -385,6 +461,12 @@ protected:
 	{
 		return MemberList::MemberMap();
 	}
+	/// Generates the identifier to be returned by ``richIdentifier()``.
+	virtual std::string makeRichIdentifier() const = 0;
+	/// Generates the name to be returned by ``toString(_short)``.
+	virtual std::string makeToString(bool _short) const = 0;
+	/// Generates the name to be returned by ``canonicalName()``. Defaults to the short name.
+	virtual std::string makeCanonicalName() const { return toString(true); }
 	/// Generates the stack items to be returned by ``stackItems()``. Defaults
 	/// to exactly one unnamed and untyped stack item referring to a single stack slot.
 	virtual std::vector<std::tuple<std::string, TypePointer>> makeStackItems() const
@@ -393,12 +475,51 @@ protected:
 	}
 
 
-	/// List of member types (parameterised by scape), will be lazy-initialized.
-	mutable std::map<ASTNode const*, std::unique_ptr<MemberList>> m_members;
-	mutable std::optional<std::vector<std::tuple<std::string, TypePointer>>> m_stackItems;
-	mutable std::optional<size_t> m_stackSize;
+	/// The members of the type in one scope, in a list that is only prepended to.
+	struct ScopeMembers
+	{
+		ASTNode const* scope;
+		MemberList members;
+		std::unique_ptr<ScopeMembers const> next;
+	};
+
+	/// List of member types (parameterised by scope), will be lazy-initialized. m_members is the
+	/// head of the list, which is published after a new entry was added, so that the list can
+	/// be searched without locking. m_memberLists owns the entries.
+	mutable std::atomic<ScopeMembers const*> m_members{nullptr};
+	mutable std::unique_ptr<ScopeMembers const> m_memberLists;
+	mutable LazyState<std::vector<std::tuple<std::string, TypePointer>>> m_stackItems;
+	mutable LazyState<size_t> m_stackSize;
+	/// Names of the type, will be lazy-initialized. They only depend on values that do not
+	/// change after the type is created, so they are kept by ``clearCache()``.
+	mutable LazyState<std::string> m_richIdentifier;
+	mutable LazyState<std::string> m_identifier;
+	mutable LazyState<std::string> m_longName;
+	mutable LazyState<std::string> m_shortName;
+	mutable LazyState<std::string> m_canonicalName;
 };
 
+template <typename T>
+template <typename F>
+T const& LazyState<T>::init(F&& _compute)
+{
+	if (!m_ready.load(std::memory_order_acquire))
+	{
+		Type::LazyStateLock lock;
+		if (!m_ready.load(std::memory_order_relaxed))
+		{
+			T value = std::forward<F>(_compute)();
+			// The computation can request the value itself, which then is already set.
+			if (!m_ready.load(std::memory_order_relaxed))
+			{
+				m_value.emplace(std::move(value));
+				m_ready.store(true, std::memory_order_release);
+			}
+		}
+	}
+	return *m_value;
+}
+
 /**
  * Type for addresses.
  */
@@ -409,7 +530,6 @@ public:
 
 	Category category() const override { return Category::Address; }
 
-	std::string richIdentifier() const override;
 	BoolResult isImplicitlyConvertibleTo(Type const& _other) const override;
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
 	TypeResult unaryOperatorResult(Token _operator) const override;
@@ -425,9 +545,6 @@ public:
 
 	MemberList::MemberMap nativeMembers(ASTNode const*) const override;
 
-	std::string toString(bool _short) const override;
-	std::string canonicalName() const override;
-
 	u256 literalValue(Literal const* _literal) const override;
 
 	TypePointer encodingType() const override { return this; }
@@ -435,6 +552,10 @@ public:
 
 	StateMutability stateMutability(void) const { return m_stateMutability; }
 
+protected:
+	std::string makeRichIdentifier() const override;
+	std::string makeToString(bool _short) const override;
+	std::string makeCanonicalName() const override;
 private:
 	StateMutability m_stateMutability;
 };
@@ -454,7 +575,6 @@ public:
 
 	Category category() const override { return Category::Integer; }
 
-	std::string richIdentifier() const override;
 	BoolResult isImplicitlyConvertibleTo(Type const& _convertTo) const override;
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
 	TypeResult unaryOperatorResult(Token _operator) const override;
@@ -468,8 +588,6 @@ public:
 	bool isValueType() const override { return true; }
 	bool nameable() const override { return true; }
 
-	std::string toString(bool _short) const override;
-
 	TypePointer encodingType() const override { return this; }
 	TypeResult interfaceType(bool) const override { return this; }
 
@@ -482,6 +600,9 @@ public:
 	bigint minValue() const;
 	bigint maxValue() const;
 
+protected:
+	std::string makeRichIdentifier() const override;
+	std::string makeToString(bool _short) const override;
 private:
 	unsigned const m_bits;
 	Modifier const m_modifier;
@@ -501,7 +622,6 @@ public:
 	explicit FixedPointType(unsigned _totalBits, unsigned _fractionalDigits, Modifier _modifier = Modifier::Unsigned);
 	Category category() const override { return Category::FixedPoint; }
 
-	std::string richIdentifier() const override;
 	BoolResult isImplicitlyConvertibleTo(Type const& _convertTo) const override;
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
 	TypeResult unaryOperatorResult(Token _operator) const override;
@@ -515,8 +635,6 @@ public:
 	bool isValueType() const override { return true; }
 	bool nameable() const override { return true; }
 
-	std::string toString(bool _short) const override;
-
 	TypePointer encodingType() const override { return this; }
 	TypeResult interfaceType(bool) const override { return this; }
 
@@ -535,6 +653,9 @@ public:
 	/// @returns the smallest integer type that can hold this type with fractional parts shifted to integers.
 	IntegerType const* asIntegerType() const;
 
+protected:
+	std::string makeRichIdentifier() const override;
+	std::string makeToString(bool _short) const override;
 private:
 	unsigned m_totalBits;
 	unsigned m_fractionalDigits;
@@ -560,12 +681,10 @@ public:
 	TypeResult unaryOperatorResult(Token _operator) const override;
 	TypeResult binaryOperatorResult(Token _operator, Type const* _other) const override;
 
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 
 	bool canBeStored() const override { return false; }
 
-	std::string toString(bool _short) const override;
 	u256 literalValue(Literal const* _literal) const override;
 	TypePointer mobileType() const override;
 
@@ -593,6 +712,9 @@ public:
 	/// @returns true if the literal is a valid integer.
 	static std::tuple<bool, rational> isValidLiteral(Literal const& _literal);
 
+protected:
+	std::string makeRichIdentifier() const override;
+	std::string makeToString(bool _short) const override;
 private:
 	rational m_value;
 
@@ -625,17 +747,17 @@ public:
 		return nullptr;
 	}
 
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 
 	bool canBeStored() const override { return false; }
 
-	std::string toString(bool) const override;
 	TypePointer mobileType() const override;
 
 	std::string const& value() const { return m_value; }
 
 protected:
+	std::string makeRichIdentifier() const override;
+	std::string makeToString(bool) const override;
 	std::vector<std::tuple<std::string, TypePointer>> makeStackItems() const override { return {}; }
 private:
 	std::string m_value;
@@ -653,7 +775,6 @@ public:
 
 	BoolResult isImplicitlyConvertibleTo(Type const& _convertTo) const override;
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	TypeResult unaryOperatorResult(Token _operator) const override;
 	TypeResult binaryOperatorResult(Token _operator, Type const* _other) const override;
@@ -664,13 +785,15 @@ public:
 	bool isValueType() const override { return true; }
 	bool nameable() const override { return true; }
 
-	std::string toString(bool) const override { return "bytes" + util::toString(m_bytes); }
 	MemberList::MemberMap nativeMembers(ASTNode const*) const override;
 	TypePointer encodingType() const override { return this; }
 	TypeResult interfaceType(bool) const override { return this; }
 
 	unsigned numBytes() const { return m_bytes; }
 
+protected:
+	std::string makeRichIdentifier() const override;
+	std::string makeToString(bool) const override { return "bytes" + util::toString(m_bytes); }
 private:
 	unsigned m_bytes;
 };
@@ -682,7 +805,6 @@ class BoolType: public Type
 {
 public:
 	Category category() const override { return Category::Bool; }
-	std::string richIdentifier() const override { return "t_bool"; }
 	TypeResult unaryOperatorResult(Token _operator) const override;
 	TypeResult binaryOperatorResult(Token _operator, Type const* _other) const override;
 
@@ -692,10 +814,12 @@ public:
 	bool isValueType() const override { return true; }
 	bool nameable() const override { return true; }
 
-	std::string toString(bool) const override { return "bool"; }
 	u256 literalValue(Literal const* _literal) const override;
 	TypePointer encodingType() const override { return this; }
 	TypeResult interfaceType(bool) const override { return this; }
+protected:
+	std::string makeRichIdentifier() const override { return "t_bool"; }
+	std::string makeToString(bool) const override { return "bool"; }
 };
 
 /**
@@ -816,7 +940,6 @@ public:
 
 	BoolResult isImplicitlyConvertibleTo(Type const& _convertTo) const override;
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	unsigned calldataEncodedSize(bool) const override;
 	unsigned calldataEncodedTailSize() const override;
@@ -827,8 +950,6 @@ public:
 	bool containsNestedMapping() const override { return m_baseType->containsNestedMapping(); }
 	bool nameable() const override { return true; }
 
-	std::string toString(bool _short) const override;
-	std::string canonicalName() const override;
 	std::string signatureInExternalFunction(bool _structsByName) const override;
 	MemberList::MemberMap nativeMembers(ASTNode const* _currentScope) const override;
 	TypePointer encodingType() const override;
@@ -858,6 +979,9 @@ public:
 	void clearCache() const override;
 
 protected:
+	std::string makeRichIdentifier() const override;
+	std::string makeToString(bool _short) const override;
+	std::string makeCanonicalName() const override;
 	std::vector<std::tuple<std::string, TypePointer>> makeStackItems() const override;
 	std::vector<Type const*> decomposition() const override { return {m_baseType}; }
 
@@ -872,8 +996,8 @@ private:
 	Type const* m_baseType;
 	bool m_hasDynamicLength = true;
 	u256 m_length;
-	mutable std::optional<TypeResult> m_interfaceType;
-	mutable std::optional<TypeResult> m_interfaceType_library;
+	mutable LazyState<TypeResult> m_interfaceType;
+	mutable LazyState<TypeResult> m_interfaceType_library;
 };
 
 class ArraySliceType: public ReferenceType
@@ -883,13 +1007,11 @@ public:
 	Category category() const override { return Category::ArraySlice; }
 
 	BoolResult isImplicitlyConvertibleTo(Type const& _other) const override;
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	unsigned calldataEncodedSize(bool) const override { solAssert(false, ""); }
 	unsigned calldataEncodedTailSize() const override { return 32; }
 	bool isDynamicallySized() const override { return true; }
 	bool isDynamicallyEncoded() const override { return true; }
-	std::string toString(bool _short) const override;
 	TypePointer mobileType() const override;
 
 	BoolResult validForLocation(DataLocation _loc) const override { return m_arrayType.validForLocation(_loc); }
@@ -900,6 +1022,8 @@ public:
 	std::unique_ptr<ReferenceType> copyForLocation(DataLocation, bool) const override { solAssert(false, ""); }
 
 protected:
+	std::string makeRichIdentifier() const override;
+	std::string makeToString(bool _short) const override;
 	std::vector<std::tuple<std::string, TypePointer>> makeStackItems() const override;
 	std::vector<Type const*> decomposition() const override { return {m_arrayType.baseType()}; }
 
@@ -922,7 +1046,6 @@ public:
 	/// Contracts can only be explicitly converted to address types and base contracts.
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
 	TypeResult unaryOperatorResult(Token _operator) const override;
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	unsigned calldataEncodedSize(bool _padded ) const override
 	{
@@ -933,8 +1056,6 @@ public:
 	bool leftAligned() const override { solAssert(!isSuper(), ""); return false; }
 	bool isValueType() const override { return !isSuper(); }
 	bool nameable() const override { return !isSuper(); }
-	std::string toString(bool _short) const override;
-	std::string canonicalName() const override;
 
 	MemberList::MemberMap nativeMembers(ASTNode const* _currentScope) const override;
 
@@ -965,13 +1086,16 @@ public:
 	/// @returns a list of all immutable variables (including inherited) of the contract.
 	std::vector<VariableDeclaration const*> immutableVariables() const;
 protected:
+	std::string makeRichIdentifier() const override;
+	std::string makeToString(bool _short) const override;
+	std::string makeCanonicalName() const override;
 	std::vector<std::tuple<std::string, TypePointer>> makeStackItems() const override;
 private:
 	ContractDefinition const& m_contract;
 	/// If true, this is a special "super" type of m_contract containing only members that m_contract inherited
 	bool m_super = false;
 	/// Type of the constructor, @see constructorType. Lazily initialized.
-	mutable FunctionType const* m_constructorType = nullptr;
+	mutable LazyState<FunctionType const*> m_constructorType;
 };
 
 /**
@@ -985,7 +1109,6 @@ public:
 
 	Category category() const override { return Category::Struct; }
 	BoolResult isImplicitlyConvertibleTo(Type const& _convertTo) const override;
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	unsigned calldataEncodedSize(bool) const override;
 	unsigned calldataEncodedTailSize() const override;
@@ -995,7 +1118,6 @@ public:
 	u256 storageSize() const override;
 	bool containsNestedMapping() const override;
 	bool nameable() const override { return true; }
-	std::string toString(bool _short) const override;
 
 	MemberList::MemberMap nativeMembers(ASTNode const* _currentScope) const override;
 
@@ -1008,7 +1130,6 @@ public:
 
 	std::unique_ptr<ReferenceType> copyForLocation(DataLocation _location, bool _isPointer) const override;
 
-	std::string canonicalName() const override;
 	std::string signatureInExternalFunction(bool _structsByName) const override;
 
 	/// @returns a function that performs the type conversion between a list of struct members
@@ -1027,14 +1148,17 @@ public:
 	void clearCache() const override;
 
 protected:
+	std::string makeRichIdentifier() const override;
+	std::string makeToString(bool _short) const override;
+	std::string makeCanonicalName() const override;
 	std::vector<std::tuple<std::string, TypePointer>> makeStackItems() const override;
 	std::vector<Type const*> decomposition() const override;
 
 private:
 	StructDefinition const& m_struct;
 	// Caches for interfaceType(bool)
-	mutable std::optional<TypeResult> m_interfaceType;
-	mutable std::optional<TypeResult> m_interfaceType_library;
+	mutable LazyState<TypeResult> m_interfaceType;
+	mutable LazyState<TypeResult> m_interfaceType_library;
 };
 
 /**
@@ -1047,7 +1171,6 @@ public:
 
 	Category category() const override { return Category::Enum; }
 	TypeResult unaryOperatorResult(Token _operator) const override;
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	unsigned calldataEncodedSize(bool _padded) const override
 	{
@@ -1055,8 +1178,6 @@ public:
 	}
 	unsigned storageBytes() const override;
 	bool leftAligned() const override { return false; }
-	std::string toString(bool _short) const override;
-	std::string canonicalName() const override;
 	bool isValueType() const override { return true; }
 	bool nameable() const override { return true; }
 
@@ -1072,6 +1193,10 @@ public:
 	unsigned int memberValue(ASTString const& _member) const;
 	size_t numberOfMembers() const;
 
+protected:
+	std::string makeRichIdentifier() const override;
+	std::string makeToString(bool _short) const override;
+	std::string makeCanonicalName() const override;
 private:
 	EnumDefinition const& m_enum;
 };
@@ -1088,10 +1213,8 @@ public:
 	Category category() const override { return Category::Tuple; }
 
 	BoolResult isImplicitlyConvertibleTo(Type const& _other) const override;
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	TypeResult binaryOperatorResult(Token, Type const*) const override { return nullptr; }
-	std::string toString(bool) const override;
 	bool canBeStored() const override { return false; }
 	u256 storageSize() const override;
 	bool hasSimpleZeroValueInMemory() const override { return false; }
@@ -1102,6 +1225,8 @@ public:
 	std::vector<TypePointer> const& components() const { return m_components; }
 
 protected:
+	std::string makeRichIdentifier() const override;
+	std::string makeToString(bool) const override;
 	std::vector<std::tuple<std::string, TypePointer>> makeStackItems() const override;
 	std::vector<Type const*> decomposition() const override
 	{
@@ -1255,14 +1380,11 @@ public:
 	/// @returns the "self" parameter type for a bound function
 	Type const* selfType() const;
 
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	BoolResult isImplicitlyConvertibleTo(Type const& _convertTo) const override;
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
 	TypeResult unaryOperatorResult(Token _operator) const override;
 	TypeResult binaryOperatorResult(Token, Type const*) const override;
-	std::string canonicalName() const override;
-	std::string toString(bool _short) const override;
 	unsigned calldataEncodedSize(bool _padded) const override;
 	bool canBeStored() const override { return m_kind == Kind::Internal || m_kind == Kind::External; }
 	u256 storageSize() const override;
@@ -1368,6 +1490,9 @@ public:
 	FunctionTypePointer asExternallyCallableFunction(bool _inLibrary) const;
 
 protected:
+	std::string makeRichIdentifier() const override;
+	std::string makeToString(bool _short) const override;
+	std::string makeCanonicalName() const override;
 	std::vector<std::tuple<std::string, TypePointer>> makeStackItems() const override;
 private:
 	static TypePointers parseElementaryTypeVector(strings const& _types);
@@ -1401,10 +1526,7 @@ public:
 
 	Category category() const override { return Category::Mapping; }
 
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
-	std::string toString(bool _short) const override;
-	std::string canonicalName() const override;
 	bool containsNestedMapping() const override { return true; }
 	TypeResult binaryOperatorResult(Token, Type const*) const override { return nullptr; }
 	Type const* encodingType() const override;
@@ -1418,6 +1540,9 @@ public:
 	Type const* valueType() const { return m_valueType; }
 
 protected:
+	std::string makeRichIdentifier() const override;
+	std::string makeToString(bool _short) const override;
+	std::string makeCanonicalName() const override;
 	std::vector<Type const*> decomposition() const override { return {m_valueType}; }
 
 private:
@@ -1439,16 +1564,16 @@ public:
 	Type const* actualType() const { return m_actualType; }
 
 	TypeResult binaryOperatorResult(Token, Type const*) const override { return nullptr; }
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	bool canBeStored() const override { return false; }
 	u256 storageSize() const override;
 	bool hasSimpleZeroValueInMemory() const override { solAssert(false, ""); }
-	std::string toString(bool _short) const override { return "type(" + m_actualType->toString(_short) + ")"; }
 	MemberList::MemberMap nativeMembers(ASTNode const* _currentScope) const override;
 
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
 protected:
+	std::string makeRichIdentifier() const override;
+	std::string makeToString(bool _short) const override { return "type(" + m_actualType->toString(_short) + ")"; }
 	std::vector<std::tuple<std::string, TypePointer>> makeStackItems() const override;
 private:
 	TypePointer m_actualType;
@@ -1469,10 +1594,10 @@ public:
 	bool canBeStored() const override { return false; }
 	u256 storageSize() const override;
 	bool hasSimpleZeroValueInMemory() const override { solAssert(false, ""); }
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
-	std::string toString(bool _short) const override;
 protected:
+	std::string makeRichIdentifier() const override;
+	std::string makeToString(bool _short) const override;
 	std::vector<std::tuple<std::string, TypePointer>> makeStackItems() const override { return {}; }
 private:
 	TypePointers m_parameterTypes;
@@ -1491,15 +1616,14 @@ public:
 	Category category() const override { return Category::Module; }
 
 	TypeResult binaryOperatorResult(Token, Type const*) const override { return nullptr; }
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	bool canBeStored() const override { return false; }
 	bool hasSimpleZeroValueInMemory() const override { solAssert(false, ""); }
 	MemberList::MemberMap nativeMembers(ASTNode const*) const override;
 
-	std::string toString(bool _short) const override;
-
 protected:
+	std::string makeRichIdentifier() const override;
+	std::string makeToString(bool _short) const override;
 	std::vector<std::tuple<std::string, TypePointer>> makeStackItems() const override { return {}; }
 private:
 	SourceUnit const& m_sourceUnit;
@@ -1530,19 +1654,18 @@ public:
 		return nullptr;
 	}
 
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	bool canBeStored() const override { return false; }
 	bool hasSimpleZeroValueInMemory() const override { solAssert(false, ""); }
 	MemberList::MemberMap nativeMembers(ASTNode const*) const override;
 
-	std::string toString(bool _short) const override;
-
 	Kind kind() const { return m_kind; }
 
 	TypePointer typeArgument() const;
 
 protected:
+	std::string makeRichIdentifier() const override;
+	std::string makeToString(bool _short) const override;
 	std::vector<std::tuple<std::string, TypePointer>> makeStackItems() const override { return {}; }
 private:
 	Kind m_kind;
@@ -1559,7 +1682,6 @@ class InaccessibleDynamicType: public Type
 public:
 	Category category() const override { return Category::InaccessibleDynamic; }
 
-	std::string richIdentifier() const override { return "t_inaccessible"; }
 	BoolResult isImplicitlyConvertibleTo(Type const&) const override { return false; }
 	BoolResult isExplicitlyConvertibleTo(Type const&) const override { return false; }
 	TypeResult binaryOperatorResult(Token, Type const*) const override { return nullptr; }
@@ -1567,8 +1689,10 @@ public:
 	bool canBeStored() const override { return false; }
 	bool isValueType() const override { return true; }
 	bool hasSimpleZeroValueInMemory() const override { solAssert(false, ""); }
-	std::string toString(bool) const override { return "inaccessible dynamic type"; }
 	TypePointer decodingType() const override;
+protected:
+	std::string makeRichIdentifier() const override { return "t_inaccessible"; }
+	std::string makeToString(bool) const override { return "inaccessible dynamic type"; }
 };
 
 }
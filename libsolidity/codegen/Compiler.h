@@ -36,19 +36,27 @@ namespace solidity::frontend {
 class Compiler
 {
 public:
-	Compiler(langutil::EVMVersion _evmVersion, RevertStrings _revertStrings, OptimiserSettings _optimiserSettings):
+	Compiler(
+		langutil::EVMVersion _evmVersion,
+		RevertStrings _revertStrings,
+		OptimiserSettings _optimiserSettings,
+		size_t _parallelism = 1
+	):
 		m_optimiserSettings(std::move(_optimiserSettings)),
+		m_parallelism(_parallelism),
 		m_runtimeContext(_evmVersion, _revertStrings),
 		m_context(_evmVersion, _revertStrings, &m_runtimeContext)
 	{ }
 
-	/// Compiles a contract.
+	/// Compiles a contract. The assembly is not optimised yet, see optimise().
 	/// @arg _metadata contains the to be injected metadata CBOR
 	void compileContract(
 		ContractDefinition const& _contract,
 		std::map<ContractDefinition const*, std::shared_ptr<Compiler const>> const& _otherCompilers,
 		bytes const& _metadata
 	);
+	/// Optimises the assembly of the compiled contract according to the optimiser settings.
+	void optimise();
 	/// @returns Entire assembly.
 	evmasm::Assembly const& assembly() const { return m_context.assembly(); }
 	/// @returns Runtime assembly.
@@ -67,6 +75,8 @@ public:
 
 private:
 	OptimiserSettings const m_optimiserSettings;
+	/// Maximum number of threads used to optimise independent sub-assemblies.
+	size_t const m_parallelism = 1;
 	CompilerContext m_runtimeContext;
 	size_t m_runtimeSub = size_t(-1); ///< Identifier of the runtime sub-assembly, if present.
 	CompilerContext m_context;
@@ -277,8 +277,11 @@ public:
 	/// Appends arbitrary data to the end of the bytecode.
 	void appendAuxiliaryData(bytes const& _data) { m_asm->appendAuxiliaryDataToEnd(_data); }
 
-	/// Run optimisation step.
-	void optimise(OptimiserSettings const& _settings) { m_asm->optimise(translateOptimiserSettings(_settings)); }
+	/// Run optimisation step, using up to @a _parallelism threads for independent sub-assemblies.
+	void optimise(OptimiserSettings const& _settings, size_t _parallelism = 1)
+	{
+		m_asm->optimise(translateOptimiserSettings(_settings, _parallelism));
+	}
 
 	/// @returns the runtime context if in creation mode and runtime context is set, nullptr otherwise.
 	CompilerContext* runtimeContext() const { return m_runtimeContext; }
@@ -309,7 +312,7 @@ private:
 	/// Updates source location set in the assembly.
 	void updateSourceLocation();
 
-	evmasm::Assembly::OptimiserSettings translateOptimiserSettings(OptimiserSettings const& _settings);
+	evmasm::Assembly::OptimiserSettings translateOptimiserSettings(OptimiserSettings const& _settings, size_t _parallelism);
 
 	/**
 	 * Helper class that manages function labels and ensures that referenced functions are
@@ -48,32 +48,50 @@ using namespace solidity;
 using namespace solidity::util;
 using namespace solidity::frontend;
 
-pair<string, string> IRGenerator::run(
+namespace
+{
+
+string const irWarning =
+	"/*******************************************************\n"
+	" *                       WARNING                       *\n"
+	" *  Solidity to Yul compilation is still EXPERIMENTAL  *\n"
+	" *       It can result in LOSS OF FUNDS or worse       *\n"
+	" *                !USE AT YOUR OWN RISK!               *\n"
+	" *******************************************************/\n\n";
+
+}
+
+string IRGenerator::run(
 	ContractDefinition const& _contract,
 	map<ContractDefinition const*, string_view const> const& _otherYulSources
 )
 {
-	string const ir = yul::reindent(generate(_contract, _otherYulSources));
+	return irWarning + yul::reindent(generate(_contract, _otherYulSources));
+}
 
-	yul::AssemblyStack asmStack(m_evmVersion, yul::AssemblyStack::Language::StrictAssembly, m_optimiserSettings);
-	if (!asmStack.parseAndAnalyze("", ir))
+string IRGenerator::optimize(
+	string const& _ir,
+	langutil::EVMVersion _evmVersion,
+	OptimiserSettings const& _optimiserSettings,
+	Json::Value* _optimiserProfile,
+	size_t _parallelism
+)
+{
+	yul::AssemblyStack asmStack(_evmVersion, yul::AssemblyStack::Language::StrictAssembly, _optimiserSettings);
+	asmStack.setOptimiserParallelism(_parallelism);
+	asmStack.enableOptimiserProfiling(_optimiserProfile != nullptr);
+	if (!asmStack.parseAndAnalyze("", _ir))
 	{
 		string errorMessage;
 		for (auto const& error: asmStack.errors())
 			errorMessage += langutil::SourceReferenceFormatter::formatErrorInformation(*error);
-		solAssert(false, ir + "\n\nInvalid IR generated:\n" + errorMessage + "\n");
+		solAssert(false, _ir + "\n\nInvalid IR generated:\n" + errorMessage + "\n");
 	}
 	asmStack.optimize();
+	if (_optimiserProfile)
+		*_optimiserProfile = asmStack.optimiserProfile();
 
-	string warning =
-		"/*******************************************************\n"
-		" *                       WARNING                       *\n"
-		" *  Solidity to Yul compilation is still EXPERIMENTAL  *\n"
-		" *       It can result in LOSS OF FUNDS or worse       *\n"
-		" *                !USE AT YOUR OWN RISK!               *\n"
-		" *******************************************************/\n\n";
-
-	return {warning + ir, warning + asmStack.print()};
+	return irWarning + asmStack.print();
 }
 
 string IRGenerator::generate(
@@ -28,6 +28,9 @@
 #include <libsolidity/codegen/ir/IRGenerationContext.h>
 #include <libsolidity/codegen/YulUtilFunctions.h>
 #include <liblangutil/EVMVersion.h>
+
+#include <json/json.h>
+
 #include <string>
 
 namespace solidity::frontend
@@ -49,13 +52,25 @@ public:
 		m_utils(_evmVersion, m_context.revertStrings(), m_context.functionCollector())
 	{}
 
-	/// Generates and returns the IR code, in unoptimized and optimized form
-	/// (or just pretty-printed, depending on the optimizer settings).
-	std::pair<std::string, std::string> run(
+	/// Generates and returns the unoptimized IR code.
+	std::string run(
 		ContractDefinition const& _contract,
 		std::map<ContractDefinition const*, std::string_view const> const& _otherYulSources
 	);
 
+	/// Validates and optimizes (or just pretty-prints, depending on the optimizer settings)
+	/// IR code generated by run().
+	/// Does not access the AST, so it can be called for different contracts concurrently.
+	/// @param _optimiserProfile if not null, receives the profile of the Yul optimiser steps.
+	/// @param _parallelism maximum number of threads used to optimise different functions concurrently.
+	static std::string optimize(
+		std::string const& _ir,
+		langutil::EVMVersion _evmVersion,
+		OptimiserSettings const& _optimiserSettings,
+		Json::Value* _optimiserProfile = nullptr,
+		size_t _parallelism = 1
+	);
+
 private:
 	std::string generate(
 		ContractDefinition const& _contract,
@@ -42,7 +42,7 @@ BMC::BMC(
 	ModelCheckerSettings const& _settings
 ):
 	SMTEncoder(_context),
-	m_interface(make_unique<smtutil::SMTPortfolio>(_smtlib2Responses, _smtCallback, _enabledSolvers, _settings.timeout)),
+	m_interface(make_unique<smtutil::SMTPortfolio>(_smtlib2Responses, _smtCallback, _enabledSolvers, _settings.timeout, _settings.solverStrategy)),
 	m_outerErrorReporter(_errorReporter),
 	m_settings(_settings)
 {
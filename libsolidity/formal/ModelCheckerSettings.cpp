@@ -53,3 +53,12 @@ std::optional<ModelCheckerTargets> ModelCheckerTargets::fromString(string const&
 
 	return ModelCheckerTargets{chosenTargets};
 }
+
+std::optional<smtutil::SMTPortfolioStrategy> solidity::frontend::solverStrategyFromString(string const& _strategy)
+{
+	if (_strategy == "crossCheck")
+		return smtutil::SMTPortfolioStrategy::CrossCheck;
+	if (_strategy == "race")
+		return smtutil::SMTPortfolioStrategy::Race;
+	return {};
+}
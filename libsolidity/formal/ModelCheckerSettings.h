@@ -67,11 +67,15 @@ struct ModelCheckerTargets
 	std::set<VerificationTargetType> targets;
 };
 
+/// @returns the solver strategy with the given name ("crossCheck" or "race") or nullopt if there is none.
+std::optional<smtutil::SMTPortfolioStrategy> solverStrategyFromString(std::string const& _strategy);
+
 struct ModelCheckerSettings
 {
 	ModelCheckerEngine engine = ModelCheckerEngine::All();
 	ModelCheckerTargets targets = ModelCheckerTargets::All();
 	std::optional<unsigned> timeout;
+	smtutil::SMTPortfolioStrategy solverStrategy = smtutil::SMTPortfolioStrategy::CrossCheck;
 };
 
 }
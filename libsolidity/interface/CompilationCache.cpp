@@ -0,0 +1,94 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Persistent cache for compilation results.
+ */
+
+#include <libsolidity/interface/CompilationCache.h>
+
+#include <libsolidity/interface/Version.h>
+
+#include <libsolutil/CommonData.h>
+#include <libsolutil/Keccak256.h>
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <iterator>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::frontend;
+using namespace solidity::util;
+
+namespace fs = boost::filesystem;
+
+optional<string> CompilationCache::load(h256 const& _key) const
+{
+	ifstream file(entryPath(_key).string(), ios::in | ios::binary);
+	if (!file)
+		return nullopt;
+
+	string value{istreambuf_iterator<char>(file), istreambuf_iterator<char>()};
+	if (file.bad())
+		return nullopt;
+	return value;
+}
+
+void CompilationCache::store(h256 const& _key, string const& _value) const
+{
+	boost::system::error_code error;
+	fs::create_directories(m_directory, error);
+	if (error)
+		return;
+
+	fs::path finalPath = entryPath(_key);
+	fs::path temporaryPath = fs::unique_path(finalPath.string() + ".%%%%-%%%%-%%%%.tmp", error);
+	if (error)
+		return;
+
+	{
+		ofstream file(temporaryPath.string(), ios::out | ios::binary | ios::trunc);
+		file.write(_value.data(), static_cast<streamsize>(_value.size()));
+		file.close();
+		if (!file)
+		{
+			fs::remove(temporaryPath, error);
+			return;
+		}
+	}
+
+	fs::rename(temporaryPath, finalPath, error);
+	if (error)
+		fs::remove(temporaryPath, error);
+}
+
+h256 CompilationCache::key(string const& _kind, vector<string> const& _inputs)
+{
+	// Prefix every component with its length, so that different inputs can never
+	// produce the same string.
+	string keyData;
+	for (string const& component: vector<string>{_kind, VersionString} + _inputs)
+		keyData += to_string(component.size()) + ":" + component;
+	return keccak256(keyData);
+}
+
+fs::path CompilationCache::entryPath(h256 const& _key) const
+{
+	return m_directory / _key.hex();
+}
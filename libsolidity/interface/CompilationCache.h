@@ -0,0 +1,66 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Persistent cache for compilation results.
+ */
+
+#pragma once
+
+#include <libsolutil/FixedHash.h>
+
+#include <boost/filesystem/path.hpp>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace solidity::frontend
+{
+
+/**
+ * Content-addressed cache for compilation results that is kept on disk across compiler runs.
+ * Every entry is stored in a separate file in the cache directory, named after its key.
+ * The key has to cover all inputs that the cached value depends on, including the compiler version.
+ *
+ * The cache can be shared by several compiler processes and threads. Failures to access the
+ * cache directory are not reported, they only result in cache misses.
+ */
+class CompilationCache
+{
+public:
+	explicit CompilationCache(boost::filesystem::path _directory): m_directory(std::move(_directory)) {}
+
+	/// @returns the value stored under @a _key or nullopt if there is no such entry.
+	std::optional<std::string> load(util::h256 const& _key) const;
+	/// Stores @a _value under @a _key. The value is written to a temporary file that is renamed
+	/// afterwards, so that concurrent readers never see partially written entries.
+	void store(util::h256 const& _key, std::string const& _value) const;
+
+	/// @returns a key for a value of type @a _kind that depends on @a _inputs and the
+	/// version of the compiler.
+	static util::h256 key(std::string const& _kind, std::vector<std::string> const& _inputs);
+
+	boost::filesystem::path const& directory() const { return m_directory; }
+
+private:
+	boost::filesystem::path entryPath(util::h256 const& _key) const;
+
+	boost::filesystem::path m_directory;
+};
+
+}
@@ -70,6 +70,7 @@
 #include <libsolutil/SwarmHash.h>
 #include <libsolutil/IpfsHash.h>
 #include <libsolutil/JSON.h>
+#include <libsolutil/Parallel.h>
 
 #include <json/json.h>
 
@@ -86,6 +87,103 @@ using solidity::util::toHex;
 
 static int g_compilerStackCounts = 0;
 
+namespace
+{
+
+/// @returns a string that identifies the given optimiser settings, to be used as part of cache keys.
+string optimiserSettingsFingerprint(OptimiserSettings const& _settings)
+{
+	return
+		to_string(_settings.runOrderLiterals) +
+		to_string(_settings.runJumpdestRemover) +
+		to_string(_settings.runPeephole) +
+		to_string(_settings.runDeduplicate) +
+		to_string(_settings.runCSE) +
+		to_string(_settings.runConstantOptimiser) +
+		to_string(_settings.optimizeStackAllocation) +
+		to_string(_settings.runYulOptimiser) +
+		":" + to_string(_settings.expectedExecutionsPerDeployment) +
+		":" + _settings.yulOptimiserSteps;
+}
+
+/// @returns the JSON representation of @a _object stored in the cache.
+Json::Value linkerObjectToJson(evmasm::LinkerObject const& _object)
+{
+	Json::Value json{Json::objectValue};
+	json["object"] = toHex(_object.bytecode);
+	json["linkReferences"] = Json::objectValue;
+	for (auto const& [offset, library]: _object.linkReferences)
+		json["linkReferences"][to_string(offset)] = library;
+	json["immutableReferences"] = Json::arrayValue;
+	for (auto const& [hash, reference]: _object.immutableReferences)
+	{
+		Json::Value immutable{Json::arrayValue};
+		immutable.append(util::toCompactHexWithPrefix(hash));
+		immutable.append(reference.first);
+		for (size_t offset: reference.second)
+			immutable.append(Json::UInt64(offset));
+		json["immutableReferences"].append(move(immutable));
+	}
+	return json;
+}
+
+/// @returns the object represented by @a _json, which has been created by linkerObjectToJson.
+/// Throws if @a _json is not a valid representation.
+evmasm::LinkerObject linkerObjectFromJson(Json::Value const& _json)
+{
+	evmasm::LinkerObject object;
+	object.bytecode = util::fromHex(_json["object"].asString(), util::WhenError::Throw);
+	for (string const& offset: _json["linkReferences"].getMemberNames())
+		object.linkReferences[stoul(offset)] = _json["linkReferences"][offset].asString();
+	for (Json::Value const& immutable: _json["immutableReferences"])
+	{
+		auto& reference = object.immutableReferences[u256(immutable[0].asString())];
+		reference.first = immutable[1].asString();
+		for (Json::ArrayIndex i = 2; i < immutable.size(); ++i)
+			reference.second.emplace_back(static_cast<size_t>(immutable[i].asUInt64()));
+	}
+	return object;
+}
+
+/// Creates the annotations of all nodes of @a _sourceUnit. They are otherwise created on
+/// first access, which is not safe while the AST is accessed from multiple threads.
+void createAnnotations(SourceUnit const& _sourceUnit)
+{
+	struct AnnotationCreator: ASTConstVisitor
+	{
+		bool visitNode(ASTNode const& _node) override
+		{
+			_node.annotation();
+			return true;
+		}
+	};
+	AnnotationCreator creator;
+	_sourceUnit.accept(creator);
+}
+
+/// @returns the name of the source the primary location of the error refers to, if any.
+string const* errorSourceName(Error const& _error)
+{
+	SourceLocation const* location = boost::get_error_info<errinfo_sourceLocation>(_error);
+	if (location && location->source)
+		return &location->source->name();
+	return nullptr;
+}
+
+bool sameError(Error const& _a, Error const& _b)
+{
+	SourceLocation const* a = boost::get_error_info<errinfo_sourceLocation>(_a);
+	SourceLocation const* b = boost::get_error_info<errinfo_sourceLocation>(_b);
+	return
+		_a.errorId() == _b.errorId() &&
+		_a.type() == _b.type() &&
+		string(_a.what()) == string(_b.what()) &&
+		!a == !b &&
+		(!a || *a == *b);
+}
+
+}
+
 CompilerStack::CompilerStack(ReadCallback::Callback _readFile):
 	m_readFile{std::move(_readFile)},
 	m_enabledSMTSolvers{smtutil::SMTSolverChoice::All()},
@@ -132,6 +230,16 @@ void CompilerStack::setRemappings(vector<Remapping> const& _remappings)
 	m_remappings = _remappings;
 }
 
+void CompilerStack::setCacheDirectory(string const& _directory)
+{
+	if (m_stackState >= CompilationSuccessful)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must set the cache directory before compiling."));
+	if (_directory.empty())
+		m_cache.reset();
+	else
+		m_cache.emplace(_directory);
+}
+
 void CompilerStack::setViaIR(bool _viaIR)
 {
 	if (m_stackState >= ParsedAndImported)
@@ -139,6 +247,12 @@ void CompilerStack::setViaIR(bool _viaIR)
 	m_viaIR = _viaIR;
 }
 
+void CompilerStack::setParallelism(size_t _parallelism)
+{
+	solAssert(_parallelism >= 1, "");
+	m_parallelism = _parallelism;
+}
+
 void CompilerStack::setEVMVersion(langutil::EVMVersion _version)
 {
 	if (m_stackState >= ParsedAndImported)
@@ -222,32 +336,60 @@ void CompilerStack::reset(bool _keepSettings)
 		m_remappings.clear();
 		m_libraries.clear();
 		m_viaIR = false;
+		m_parallelism = 1;
+		m_cache.reset();
 		m_evmVersion = langutil::EVMVersion();
 		m_modelCheckerSettings = ModelCheckerSettings{};
 		m_enabledSMTSolvers = smtutil::SMTSolverChoice::All();
 		m_generateIR = false;
 		m_generateEwasm = false;
+		m_profileYulOptimiser = false;
+		m_timeReport.reset();
 		m_revertStrings = RevertStrings::Default;
 		m_optimiserSettings = OptimiserSettings::minimal();
 		m_metadataLiteralSources = false;
 		m_metadataHash = MetadataHash::IPFS;
 		m_stopAfter = State::CompilationSuccessful;
 	}
+	m_resolver.reset();
 	m_globalContext.reset();
 	m_sourceOrder.clear();
+	m_retiredSourceUnits.clear();
+	m_analysisErrorCount.reset();
 	m_contracts.clear();
 	m_errorReporter.clear();
+	if (m_timeReport)
+		m_timeReport->clear();
 	TypeProvider::reset();
 }
 
+void CompilerStack::enableTimeReport(bool _enable)
+{
+	if (!_enable)
+		m_timeReport.reset();
+	else if (!m_timeReport)
+		m_timeReport = make_unique<TimeReport>();
+}
+
 void CompilerStack::setSources(StringMap _sources)
+{
+	vector<CharStream> charStreams;
+	for (auto& [name, content]: _sources)
+		charStreams.emplace_back(move(content), name);
+	setCharStreams(move(charStreams));
+}
+
+void CompilerStack::setCharStreams(vector<CharStream> _sources)
 {
 	if (m_stackState == SourcesSet)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Cannot change sources once set."));
 	if (m_stackState != Empty)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must set sources before parsing."));
-	for (auto source: _sources)
-		m_sources[source.first].scanner = make_shared<Scanner>(CharStream(/*content*/std::move(source.second), /*name*/source.first));
+	for (CharStream& charStream: _sources)
+	{
+		string name = charStream.name();
+		m_sources[name].scanner = make_shared<Scanner>(move(charStream));
+	}
 	m_stackState = SourcesSet;
 }
 
@@ -257,18 +399,27 @@ bool CompilerStack::parse()
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must call parse only after the SourcesSet state."));
 	m_errorReporter.clear();
 
-	if (SemVerVersion{string(VersionString)}.isPrerelease())
-		m_errorReporter.warning(3805_error, "This is a pre-release compiler version, please do not use it in production.");
-
-	Parser parser{m_errorReporter, m_evmVersion, m_parserErrorRecovery};
-
 	vector<string> sourcesToParse;
 	for (auto const& s: m_sources)
 		sourcesToParse.push_back(s.first);
+	parseSources(move(sourcesToParse), 0);
+
+	return !m_hasError;
+}
+
+void CompilerStack::parseSources(vector<string> _sourcesToParse, int64_t _lastNodeID)
+{
+	solAssert(m_stackState == SourcesSet, "");
+
+	if (SemVerVersion{string(VersionString)}.isPrerelease())
+		m_errorReporter.warning(3805_error, "This is a pre-release compiler version, please do not use it in production.");
+
+	TimeReport::Stopwatch stopwatch{m_timeReport.get(), "parsing"};
+	Parser parser{m_errorReporter, m_evmVersion, m_parserErrorRecovery, _lastNodeID};
 
-	for (size_t i = 0; i < sourcesToParse.size(); ++i)
+	for (size_t i = 0; i < _sourcesToParse.size(); ++i)
 	{
-		string const& path = sourcesToParse[i];
+		string const& path = _sourcesToParse[i];
 		Source& source = m_sources[path];
 		source.scanner->reset();
 		source.ast = parser.parse(source.scanner);
@@ -278,12 +429,10 @@ bool CompilerStack::parse()
 		{
 			source.ast->annotation().path = path;
 			if (m_stopAfter >= ParsedAndImported)
-				for (auto const& newSource: loadMissingSources(*source.ast, path))
+				for (auto& [newPath, newContents]: loadMissingSources(*source.ast, path))
 				{
-					string const& newPath = newSource.first;
-					string const& newContents = newSource.second;
-					m_sources[newPath].scanner = make_shared<Scanner>(CharStream(newContents, newPath));
-					sourcesToParse.push_back(newPath);
+					m_sources[newPath].scanner = make_shared<Scanner>(CharStream(move(newContents), newPath));
+					_sourcesToParse.push_back(newPath);
 				}
 		}
 	}
@@ -296,8 +445,6 @@ bool CompilerStack::parse()
 		m_hasError = true;
 
 	storeContractDefinitions();
-
-	return !m_hasError;
 }
 
 void CompilerStack::importASTs(map<string, Json::Value> const& _sources)
@@ -312,7 +459,7 @@ void CompilerStack::importASTs(map<string, Json::Value> const& _sources)
 		Source source;
 		source.ast = src.second;
 		string srcString = util::jsonCompactPrint(m_sourceJsons[src.first]);
-		ASTPointer<Scanner> scanner = make_shared<Scanner>(langutil::CharStream(srcString, src.first));
+		ASTPointer<Scanner> scanner = make_shared<Scanner>(langutil::CharStream(move(srcString), src.first));
 		source.scanner = scanner;
 		m_sources[path] = source;
 	}
@@ -328,48 +475,78 @@ bool CompilerStack::analyze()
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must call analyze only after parsing was performed."));
 	resolveImports();
 
+	return analyzeSources({});
+}
+
+bool CompilerStack::analyzeSources(set<Source const*> const& _reusedSources)
+{
+	TimeReport::Stopwatch stopwatch{m_timeReport.get(), "analysis"};
+	vector<Source const*> sourcesToAnalyze;
 	for (Source const* source: m_sourceOrder)
+		if (!_reusedSources.count(source))
+			sourcesToAnalyze.push_back(source);
+
+	for (Source const* source: sourcesToAnalyze)
 		if (source->ast)
 			Scoper::assignScopes(*source->ast);
+	stopwatch.lap("Scoper");
 
 	bool noErrors = true;
 
 	try
 	{
 		SyntaxChecker syntaxChecker(m_errorReporter, m_optimiserSettings.runYulOptimiser);
-		for (Source const* source: m_sourceOrder)
+		for (Source const* source: sourcesToAnalyze)
 			if (source->ast && !syntaxChecker.checkSyntax(*source->ast))
 				noErrors = false;
+		stopwatch.lap("SyntaxChecker");
 
 		DocStringTagParser DocStringTagParser(m_errorReporter);
-		for (Source const* source: m_sourceOrder)
+		for (Source const* source: sourcesToAnalyze)
 			if (source->ast && !DocStringTagParser.parseDocStrings(*source->ast))
 				noErrors = false;
+		stopwatch.lap("DocStringTagParser");
 
-		m_globalContext = make_shared<GlobalContext>();
-		// We need to keep the same resolver during the whole process.
-		NameAndTypeResolver resolver(*m_globalContext, m_evmVersion, m_errorReporter);
-		for (Source const* source: m_sourceOrder)
+		if (_reusedSources.empty())
+		{
+			m_globalContext = make_shared<GlobalContext>();
+			// We need to keep the same resolver during the whole process.
+			m_resolver = make_unique<NameAndTypeResolver>(*m_globalContext, m_evmVersion, m_errorReporter);
+		}
+		solAssert(m_resolver, "");
+		NameAndTypeResolver& resolver = *m_resolver;
+		for (Source const* source: sourcesToAnalyze)
 			if (source->ast && !resolver.registerDeclarations(*source->ast))
 				return false;
 
 		map<string, SourceUnit const*> sourceUnitsByName;
 		for (auto& source: m_sources)
 			sourceUnitsByName[source.first] = source.second.ast.get();
-		for (Source const* source: m_sourceOrder)
+		for (Source const* source: sourcesToAnalyze)
 			if (source->ast && !resolver.performImports(*source->ast, sourceUnitsByName))
 				return false;
 
-		resolver.warnHomonymDeclarations();
+		if (_reusedSources.empty())
+			resolver.warnHomonymDeclarations();
+		else
+		{
+			vector<SourceUnit const*> sourceUnits;
+			for (Source const* source: sourcesToAnalyze)
+				if (source->ast)
+					sourceUnits.push_back(source->ast.get());
+			resolver.warnHomonymDeclarations(sourceUnits);
+		}
 
-		for (Source const* source: m_sourceOrder)
+		for (Source const* source: sourcesToAnalyze)
 			if (source->ast && !resolver.resolveNamesAndTypes(*source->ast))
 				return false;
+		stopwatch.lap("NameAndTypeResolver");
 
 		DeclarationTypeChecker declarationTypeChecker(m_errorReporter, m_evmVersion);
-		for (Source const* source: m_sourceOrder)
+		for (Source const* source: sourcesToAnalyze)
 			if (source->ast && !declarationTypeChecker.check(*source->ast))
 				return false;
+		stopwatch.lap("DeclarationTypeChecker");
 
 		// Next, we check inheritance, overrides, function collisions and other things at
 		// contract or function level.
@@ -377,15 +554,17 @@ bool CompilerStack::analyze()
 		// type checker.
 		ContractLevelChecker contractLevelChecker(m_errorReporter);
 
-		for (Source const* source: m_sourceOrder)
+		for (Source const* source: sourcesToAnalyze)
 			if (auto sourceAst = source->ast)
 				noErrors = contractLevelChecker.check(*sourceAst);
+		stopwatch.lap("ContractLevelChecker");
 
 		// Requires ContractLevelChecker
 		DocStringAnalyser docStringAnalyser(m_errorReporter);
-		for (Source const* source: m_sourceOrder)
+		for (Source const* source: sourcesToAnalyze)
 			if (source->ast && !docStringAnalyser.analyseDocStrings(*source->ast))
 				noErrors = false;
+		stopwatch.lap("DocStringAnalyser");
 
 		// New we run full type checks that go down to the expression level. This
 		// cannot be done earlier, because we need cross-contract types and information
@@ -395,76 +574,85 @@ bool CompilerStack::analyze()
 		// Note: this does not resolve overloaded functions. In order to do that, types of arguments are needed,
 		// which is only done one step later.
 		TypeChecker typeChecker(m_evmVersion, m_errorReporter);
-		for (Source const* source: m_sourceOrder)
+		for (Source const* source: sourcesToAnalyze)
 			if (source->ast && !typeChecker.checkTypeRequirements(*source->ast))
 				noErrors = false;
+		stopwatch.lap("TypeChecker");
 
 		if (noErrors)
 		{
 			// Checks that can only be done when all types of all AST nodes are known.
 			PostTypeChecker postTypeChecker(m_errorReporter);
-			for (Source const* source: m_sourceOrder)
+			for (Source const* source: sourcesToAnalyze)
 				if (source->ast && !postTypeChecker.check(*source->ast))
 					noErrors = false;
 			if (!postTypeChecker.finalize())
 				noErrors = false;
+			stopwatch.lap("PostTypeChecker");
 		}
 
 		// Check that immutable variables are never read in c'tors and assigned
 		// exactly once
 		if (noErrors)
-			for (Source const* source: m_sourceOrder)
+			for (Source const* source: sourcesToAnalyze)
 				if (source->ast)
 					for (ASTPointer<ASTNode> const& node: source->ast->nodes())
 						if (ContractDefinition* contract = dynamic_cast<ContractDefinition*>(node.get()))
 							ImmutableValidator(m_errorReporter, *contract).analyze();
+		if (noErrors)
+			stopwatch.lap("ImmutableValidator");
+
+		// The following checks do not modify the AST, so they can check different sources
+		// concurrently. Nodes of other sources are only read, but their annotations have to
+		// exist beforehand.
+		if (noErrors && m_parallelism > 1 && sourcesToAnalyze.size() > 1)
+			for (Source const* source: m_sourceOrder)
+				if (source->ast)
+					createAnnotations(*source->ast);
 
 		if (noErrors)
 		{
 			// Control flow graph generator and analyzer. It can check for issues such as
 			// variable is used before it is assigned to.
 			CFG cfg(m_errorReporter);
-			for (Source const* source: m_sourceOrder)
+			for (Source const* source: sourcesToAnalyze)
 				if (source->ast && !cfg.constructFlow(*source->ast))
 					noErrors = false;
 
 			if (noErrors)
-			{
-				ControlFlowAnalyzer controlFlowAnalyzer(cfg, m_errorReporter);
-				for (Source const* source: m_sourceOrder)
-					if (source->ast && !controlFlowAnalyzer.analyze(*source->ast))
-						noErrors = false;
-			}
+				noErrors = checkSources(sourcesToAnalyze, [&](shared_ptr<SourceUnit> const& _sourceUnit, ErrorReporter& _errorReporter) {
+					return ControlFlowAnalyzer(cfg, _errorReporter).analyze(*_sourceUnit);
+				});
+			stopwatch.lap("ControlFlowAnalyzer");
 		}
 
 		if (noErrors)
 		{
 			// Checks for common mistakes. Only generates warnings.
-			StaticAnalyzer staticAnalyzer(m_errorReporter);
-			for (Source const* source: m_sourceOrder)
-				if (source->ast && !staticAnalyzer.analyze(*source->ast))
-					noErrors = false;
+			noErrors = checkSources(sourcesToAnalyze, [](shared_ptr<SourceUnit> const& _sourceUnit, ErrorReporter& _errorReporter) {
+				return StaticAnalyzer(_errorReporter).analyze(*_sourceUnit);
+			});
+			stopwatch.lap("StaticAnalyzer");
 		}
 
 		if (noErrors)
 		{
-			// Check for state mutability in every function.
-			vector<ASTPointer<ASTNode>> ast;
-			for (Source const* source: m_sourceOrder)
-				if (source->ast)
-					ast.push_back(source->ast);
-
-			if (!ViewPureChecker(ast, m_errorReporter).check())
-				noErrors = false;
+			// Check for state mutability in every function. Modifiers defined in other
+			// sources are analysed again on demand.
+			noErrors = checkSources(sourcesToAnalyze, [](shared_ptr<SourceUnit> const& _sourceUnit, ErrorReporter& _errorReporter) {
+				return ViewPureChecker({_sourceUnit}, _errorReporter).check();
+			});
+			stopwatch.lap("ViewPureChecker");
 		}
 
 		if (noErrors)
 		{
 			ModelChecker modelChecker(m_errorReporter, m_smtlib2Responses, m_modelCheckerSettings, m_readFile, m_enabledSMTSolvers);
-			for (Source const* source: m_sourceOrder)
+			for (Source const* source: sourcesToAnalyze)
 				if (source->ast)
 					modelChecker.analyze(*source->ast);
 			m_unhandledSMTLib2Queries += modelChecker.unhandledQueries();
+			stopwatch.lap("ModelChecker");
 		}
 	}
 	catch (FatalError const&)
@@ -481,6 +669,49 @@ bool CompilerStack::analyze()
 	return !m_hasError;
 }
 
+bool CompilerStack::checkSources(
+	vector<Source const*> const& _sources,
+	function<bool(shared_ptr<SourceUnit> const&, ErrorReporter&)> const& _check
+)
+{
+	vector<shared_ptr<SourceUnit>> sourceUnits;
+	for (Source const* source: _sources)
+		if (source->ast)
+			sourceUnits.push_back(source->ast);
+
+	bool success = true;
+	if (m_parallelism <= 1 || sourceUnits.size() <= 1)
+	{
+		for (shared_ptr<SourceUnit> const& sourceUnit: sourceUnits)
+			if (!_check(sourceUnit, m_errorReporter))
+				success = false;
+		return success;
+	}
+
+	vector<ErrorList> errors(sourceUnits.size());
+	// Not vector<bool>, which cannot be written from multiple threads.
+	vector<char> results(sourceUnits.size(), true);
+	vector<exception_ptr> exceptions;
+	{
+		Type::ConcurrentSection concurrentSection;
+		exceptions = util::parallelFor(sourceUnits.size(), m_parallelism, [&](size_t _index) {
+			ErrorReporter errorReporter(errors[_index]);
+			results[_index] = _check(sourceUnits[_index], errorReporter);
+		});
+	}
+
+	for (size_t i = 0; i < sourceUnits.size(); ++i)
+	{
+		m_errorReporter.merge(errors[i]);
+		// A serial run would have stopped at the first failing source.
+		if (exceptions[i])
+			rethrow_exception(exceptions[i]);
+		if (!results[i])
+			success = false;
+	}
+	return success;
+}
+
 bool CompilerStack::parseAndAnalyze(State _stopAfter)
 {
 	m_stopAfter = _stopAfter;
@@ -493,6 +724,120 @@ bool CompilerStack::parseAndAnalyze(State _stopAfter)
 	return success;
 }
 
+bool CompilerStack::updateSources(StringMap const& _sources)
+{
+	if (m_stackState < Parsed)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must call updateSources only after parsing was performed."));
+	if (m_importedSources)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Cannot update sources that were imported as ASTs."));
+
+	StringMap changedSources;
+	for (auto const& [name, content]: _sources)
+		if (!m_sources.count(name) || m_sources.at(name).scanner->source() != content)
+			changedSources[name] = content;
+	if (changedSources.empty())
+		return !m_hasError;
+
+	// The changed sources and the sources that import them, directly or indirectly,
+	// have to be parsed and analysed again.
+	map<string, set<string>> importingSources;
+	for (auto const& [name, source]: m_sources)
+		if (source.ast)
+			for (ImportDirective const* import: ASTNode::filteredNodes<ImportDirective>(source.ast->nodes()))
+				if (import->annotation().absolutePath.set())
+					importingSources[*import->annotation().absolutePath].insert(name);
+	set<string> affectedSources;
+	vector<string> worklist;
+	for (auto const& changedSource: changedSources)
+		worklist.push_back(changedSource.first);
+	while (!worklist.empty())
+	{
+		string name = move(worklist.back());
+		worklist.pop_back();
+		if (affectedSources.insert(name).second)
+			for (string const& importingSource: importingSources[name])
+				worklist.push_back(importingSource);
+	}
+
+	set<Source const*> reusedSources;
+	set<string> reusedSourceNames;
+	if (m_stackState >= AnalysisPerformed && !m_hasError)
+		for (Source const* source: m_sourceOrder)
+			if (source->ast && !affectedSources.count(*source->ast->annotation().path))
+			{
+				reusedSources.insert(source);
+				reusedSourceNames.insert(*source->ast->annotation().path);
+			}
+
+	if (reusedSources.empty())
+	{
+		vector<CharStream> sources;
+		for (auto const& [name, source]: m_sources)
+			if (!changedSources.count(name))
+				sources.emplace_back(*source.scanner->charStream());
+		for (auto& [name, content]: changedSources)
+			sources.emplace_back(move(content), name);
+		map<util::h256, string> smtlib2Responses = move(m_smtlib2Responses);
+		reset(true);
+		m_smtlib2Responses = move(smtlib2Responses);
+		setCharStreams(move(sources));
+		return parseAndAnalyze(m_stopAfter);
+	}
+
+	// Warnings about the reused sources are not reported again, so they are carried over.
+	// Errors reported during code generation are dropped since the contracts are compiled again.
+	ErrorList reusedErrors;
+	for (size_t i = 0; i < m_analysisErrorCount.value_or(m_errorList.size()); ++i)
+		if (string const* sourceName = errorSourceName(*m_errorList[i]))
+			if (reusedSourceNames.count(*sourceName))
+				reusedErrors.push_back(m_errorList[i]);
+
+	// The nodes of the retired source units are still referenced by annotations and errors,
+	// so the IDs of the new nodes have to be larger than all IDs assigned so far.
+	int64_t lastNodeID = 0;
+	for (auto const& [name, source]: m_sources)
+		if (source.ast)
+			// The source unit is the last node created by the parser and thus has the largest ID.
+			lastNodeID = max(lastNodeID, source.ast->id());
+	for (shared_ptr<SourceUnit> const& sourceUnit: m_retiredSourceUnits)
+		lastNodeID = max(lastNodeID, sourceUnit->id());
+
+	for (string const& name: affectedSources)
+	{
+		Source& source = m_sources[name];
+		shared_ptr<Scanner> scanner = changedSources.count(name) ?
+			make_shared<Scanner>(CharStream(move(changedSources.at(name)), name)) :
+			source.scanner;
+		if (source.ast)
+			m_retiredSourceUnits.emplace_back(move(source.ast));
+		source.reset();
+		source.scanner = move(scanner);
+	}
+
+	m_stackState = SourcesSet;
+	m_hasError = false;
+	m_analysisErrorCount.reset();
+	m_contracts.clear();
+	m_unhandledSMTLib2Queries.clear();
+	m_errorReporter.clear();
+	if (m_timeReport)
+		m_timeReport->clear();
+
+	parseSources(vector<string>(affectedSources.begin(), affectedSources.end()), lastNodeID);
+	if (!m_hasError || m_parserErrorRecovery)
+	{
+		resolveImports();
+		analyzeSources(reusedSources);
+	}
+
+	// Warnings about the reused sources might be reported again while analysing the sources that use them.
+	for (shared_ptr<Error const> const& reusedError: reusedErrors)
+		if (none_of(m_errorList.begin(), m_errorList.end(), [&](auto const& _error) { return sameError(*_error, *reusedError); }))
+			m_errorList.push_back(reusedError);
+
+	return !m_hasError;
+}
+
 bool CompilerStack::isRequestedSource(string const& _sourceName) const
 {
 	return
@@ -531,58 +876,68 @@ bool CompilerStack::compile(State _stopAfter)
 	if (m_hasError)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Called compile with errors."));
 
+	m_analysisErrorCount = m_errorReporter.errors().size();
+	TimeReport::Stopwatch stopwatch{m_timeReport.get(), "compilation"};
+
 	// Only compile contracts individually which have been requested.
-	map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
+	// The optimisation of the IR and the legacy code generation are deferred, so that they
+	// can be done for all contracts concurrently.
+	vector<PendingCompilation> pendingCompilations;
 
-	for (Source const* source: m_sourceOrder)
-		for (ASTPointer<ASTNode> const& node: source->ast->nodes())
-			if (auto contract = dynamic_cast<ContractDefinition const*>(node.get()))
-				if (isRequestedContract(*contract))
-				{
-					try
-					{
-						if (m_viaIR || m_generateIR || m_generateEwasm)
-							generateIR(*contract);
-						if (m_generateEvmBytecode)
+	try
+	{
+		for (Source const* source: m_sourceOrder)
+			for (ASTPointer<ASTNode> const& node: source->ast->nodes())
+				if (auto contract = dynamic_cast<ContractDefinition const*>(node.get()))
+					if (isRequestedContract(*contract))
+						try
 						{
-							if (m_viaIR)
-								generateEVMFromIR(*contract);
-							else
-								compileContract(*contract, otherCompilers);
+							if (m_viaIR || m_generateIR || m_generateEwasm || m_profileYulOptimiser)
+							{
+								generateIR(*contract);
+								pendingCompilations.push_back({contract, false, m_errorReporter.errors().size()});
+							}
+							if (m_generateEvmBytecode && !m_viaIR)
+								pendingCompilations.push_back({contract, true, m_errorReporter.errors().size()});
 						}
-						if (m_generateEwasm)
-							generateEwasm(*contract);
-					}
-					catch (Error const& _error)
-					{
-						if (_error.type() != Error::Type::CodeGenerationError)
-							throw;
-						m_errorReporter.error(_error.errorId(), _error.type(), SourceLocation(), _error.what());
-						return false;
-					}
-					catch (UnimplementedFeatureError const& _unimplementedError)
-					{
-						if (
-							SourceLocation const* sourceLocation =
-							boost::get_error_info<langutil::errinfo_sourceLocation>(_unimplementedError)
-						)
+						catch (...)
 						{
-							string const* comment = _unimplementedError.comment();
-							m_errorReporter.error(
-								1834_error,
-								Error::Type::CodeGenerationError,
-								*sourceLocation,
-								"Unimplemented feature error" +
-								((comment && !comment->empty()) ? ": " + *comment : string{}) +
-								" in " +
-								_unimplementedError.lineInfo()
-							);
-							return false;
-						}
-						else
+							// Errors in contracts processed earlier take precedence.
+							compileConcurrently(pendingCompilations);
 							throw;
-					}
-				}
+						}
+		compileConcurrently(pendingCompilations);
+		storePendingCachedCode();
+	}
+	catch (Error const& _error)
+	{
+		if (_error.type() != Error::Type::CodeGenerationError)
+			throw;
+		m_errorReporter.error(_error.errorId(), _error.type(), SourceLocation(), _error.what());
+		return false;
+	}
+	catch (UnimplementedFeatureError const& _unimplementedError)
+	{
+		if (
+			SourceLocation const* sourceLocation =
+			boost::get_error_info<langutil::errinfo_sourceLocation>(_unimplementedError)
+		)
+		{
+			string const* comment = _unimplementedError.comment();
+			m_errorReporter.error(
+				1834_error,
+				Error::Type::CodeGenerationError,
+				*sourceLocation,
+				"Unimplemented feature error" +
+				((comment && !comment->empty()) ? ": " + *comment : string{}) +
+				" in " +
+				_unimplementedError.lineInfo()
+			);
+			return false;
+		}
+		else
+			throw;
+	}
 	m_stackState = CompilationSuccessful;
 	this->link();
 	return true;
@@ -598,6 +953,118 @@ void CompilerStack::link()
 	}
 }
 
+util::h256 CompilerStack::contractCacheKey(Contract const& _contract) const
+{
+	// The metadata covers the compiler version, the contents of all sources the contract depends
+	// on and the settings. The names of all sources determine the source indices.
+	vector<string> inputs{
+		metadata(_contract),
+		m_evmVersion.name(),
+		optimiserSettingsFingerprint(m_optimiserSettings),
+		to_string(static_cast<unsigned>(m_revertStrings))
+	};
+	for (auto const& source: m_sources)
+		inputs.emplace_back(source.first);
+	return CompilationCache::key("contract", inputs);
+}
+
+void CompilerStack::storeCachedCode(Contract const& _contract, util::h256 const& _key, bool _legacy) const
+{
+	Json::Value entry{Json::objectValue};
+	entry["bytecode"] = linkerObjectToJson(_contract.object);
+	entry["deployedBytecode"] = linkerObjectToJson(_contract.runtimeObject);
+	if (_legacy)
+	{
+		solAssert(_contract.evmAssembly && _contract.evmRuntimeAssembly, "");
+		map<string, unsigned> indices = sourceIndices();
+		entry["assembly"] = _contract.evmAssembly->assemblyString(assemblySources());
+		entry["legacyAssembly"] = _contract.evmAssembly->assemblyJSON(indices);
+		entry["sourceMap"] = evmasm::AssemblyItem::computeSourceMapping(_contract.evmAssembly->items(), indices);
+		entry["deployedSourceMap"] = evmasm::AssemblyItem::computeSourceMapping(_contract.evmRuntimeAssembly->items(), indices);
+		entry["generatedSources"] = createGeneratedSources(_contract, false);
+		entry["deployedGeneratedSources"] = createGeneratedSources(_contract, true);
+	}
+	m_cache->store(_key, util::jsonCompactPrint(entry));
+}
+
+void CompilerStack::storePendingCachedCode()
+{
+	for (auto& [name, contract]: m_contracts)
+		if (contract.pendingCacheKey)
+		{
+			TimeReport::Stopwatch stopwatch{m_timeReport.get(), "compilation", name};
+			storeCachedCode(contract, *contract.pendingCacheKey, true);
+			contract.pendingCacheKey.reset();
+			stopwatch.lap("codeGenerationCacheStore");
+		}
+}
+
+bool CompilerStack::loadCachedCode(Contract& _contract, util::h256 const& _key, bool _legacy) const
+{
+	optional<string> data = m_cache->load(_key);
+	Json::Value entry;
+	if (!data || !util::jsonParseStrict(*data, entry) || !entry.isObject())
+		return false;
+
+	try
+	{
+		evmasm::LinkerObject object = linkerObjectFromJson(entry["bytecode"]);
+		evmasm::LinkerObject runtimeObject = linkerObjectFromJson(entry["deployedBytecode"]);
+		if (object.bytecode.empty())
+			return false;
+		if (_legacy)
+		{
+			Json::Value& generatedSources = entry["generatedSources"];
+			Json::Value& deployedGeneratedSources = entry["deployedGeneratedSources"];
+			if (!generatedSources.isArray() || !deployedGeneratedSources.isArray())
+				return false;
+			// The parser reads the source indices as signed integers, but createGeneratedSources
+			// stores them as unsigned ones, which compare unequal in jsoncpp.
+			for (Json::Value* sources: {&generatedSources, &deployedGeneratedSources})
+				for (Json::Value& source: *sources)
+					source["id"] = source["id"].asUInt();
+			_contract.cachedAssembly = entry["assembly"].asString();
+			_contract.cachedAssemblyJSON = entry["legacyAssembly"];
+			_contract.sourceMapping.emplace(entry["sourceMap"].asString());
+			_contract.runtimeSourceMapping.emplace(entry["deployedSourceMap"].asString());
+			_contract.generatedSources.init([&]{ return generatedSources; });
+			_contract.runtimeGeneratedSources.init([&]{ return deployedGeneratedSources; });
+		}
+		_contract.object = move(object);
+		_contract.runtimeObject = move(runtimeObject);
+	}
+	catch (std::exception const&)
+	{
+		// Invalid entries are treated like missing ones.
+		return false;
+	}
+	_contract.codeFromCache = _legacy;
+	return true;
+}
+
+StringMap CompilerStack::assemblySources() const
+{
+	StringMap sources;
+	for (auto const& [name, source]: m_sources)
+		if (source.scanner)
+			sources[name] = string(source.scanner->source());
+	return sources;
+}
+
+bool CompilerStack::isAssemblySources(StringMap const& _sourceCodes) const
+{
+	size_t sourceCount = 0;
+	for (auto const& [name, source]: m_sources)
+		if (source.scanner)
+		{
+			auto it = _sourceCodes.find(name);
+			if (it == _sourceCodes.end() || it->second != source.scanner->source())
+				return false;
+			++sourceCount;
+		}
+	return sourceCount == _sourceCodes.size();
+}
+
 vector<string> CompilerStack::contractNames() const
 {
 	if (m_stackState < Parsed)
@@ -649,36 +1116,7 @@ Json::Value CompilerStack::generatedSources(string const& _contractName, bool _r
 		_runtime ?
 		c.runtimeGeneratedSources :
 		c.generatedSources;
-	return sources.init([&]{
-		Json::Value sources{Json::arrayValue};
-		// If there is no compiler, then no bytecode was generated and thus no
-		// sources were generated.
-		if (c.compiler)
-		{
-			string source =
-				_runtime ?
-				c.compiler->runtimeGeneratedYulUtilityCode() :
-				c.compiler->generatedYulUtilityCode();
-			if (!source.empty())
-			{
-				string sourceName = CompilerContext::yulUtilityFileName();
-				unsigned sourceIndex = sourceIndices()[sourceName];
-				ErrorList errors;
-				ErrorReporter errorReporter(errors);
-				auto scanner = make_shared<langutil::Scanner>(langutil::CharStream(source, sourceName));
-				yul::EVMDialect const& dialect = yul::EVMDialect::strictAssemblyForEVM(m_evmVersion);
-				shared_ptr<yul::Block> parserResult = yul::Parser{errorReporter, dialect}.parse(scanner, false);
-				solAssert(parserResult, "");
-				sources[0]["ast"] = yul::AsmJsonConverter{sourceIndex}(*parserResult);
-				sources[0]["name"] = sourceName;
-				sources[0]["id"] = sourceIndex;
-				sources[0]["language"] = "Yul";
-				sources[0]["contents"] = move(source);
-
-			}
-		}
-		return sources;
-	});
+	return sources.init([&]{ return createGeneratedSources(c, _runtime); });
 }
 
 string const* CompilerStack::sourceMapping(string const& _contractName) const
@@ -751,6 +1189,22 @@ string const& CompilerStack::yulIROptimized(string const& _contractName) const
 	return contract(_contractName).yulIROptimized;
 }
 
+Json::Value CompilerStack::timeReport() const
+{
+	if (!m_timeReport)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Time report was not enabled."));
+
+	return m_timeReport->toJson();
+}
+
+Json::Value const& CompilerStack::yulOptimiserProfile(string const& _contractName) const
+{
+	if (m_stackState != CompilationSuccessful)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Compilation was not successful."));
+
+	return contract(_contractName).yulOptimiserProfile;
+}
+
 string const& CompilerStack::ewasm(string const& _contractName) const
 {
 	if (m_stackState != CompilationSuccessful)
@@ -784,13 +1238,21 @@ evmasm::LinkerObject const& CompilerStack::runtimeObject(string const& _contract
 }
 
 /// TODO: cache this string
-string CompilerStack::assemblyString(string const& _contractName, StringMap _sourceCodes) const
+string CompilerStack::assemblyString(string const& _contractName, StringMap const& _sourceCodes) const
 {
 	if (m_stackState != CompilationSuccessful)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Compilation was not successful."));
 
 	Contract const& currentContract = contract(_contractName);
-	if (currentContract.evmAssembly)
+	if (currentContract.codeFromCache)
+	{
+		if (!isAssemblySources(_sourceCodes))
+			BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment(
+				"The assembly of contracts taken from the cache is only available for the compiled sources."
+			));
+		return currentContract.cachedAssembly;
+	}
+	else if (currentContract.evmAssembly)
 		return currentContract.evmAssembly->assemblyString(_sourceCodes);
 	else
 		return string();
@@ -803,7 +1265,9 @@ Json::Value CompilerStack::assemblyJSON(string const& _contractName) const
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Compilation was not successful."));
 
 	Contract const& currentContract = contract(_contractName);
-	if (currentContract.evmAssembly)
+	if (currentContract.codeFromCache)
+		return currentContract.cachedAssemblyJSON;
+	else if (currentContract.evmAssembly)
 		return currentContract.evmAssembly->assemblyJSON(sourceIndices());
 	else
 		return Json::Value();
@@ -1000,21 +1464,24 @@ tuple<int, int, int, int> CompilerStack::positionFromSourceLocation(SourceLocati
 h256 const& CompilerStack::Source::keccak256() const
 {
 	if (keccak256HashCached == h256{})
-		keccak256HashCached = util::keccak256(scanner->source());
+	{
+		string_view source = scanner->source();
+		keccak256HashCached = util::keccak256(bytesConstRef(reinterpret_cast<uint8_t const*>(source.data()), source.size()));
+	}
 	return keccak256HashCached;
 }
 
 h256 const& CompilerStack::Source::swarmHash() const
 {
 	if (swarmHashCached == h256{})
-		swarmHashCached = util::bzzr1Hash(scanner->source());
+		swarmHashCached = util::bzzr1Hash(string(scanner->source()));
 	return swarmHashCached;
 }
 
 string const& CompilerStack::Source::ipfsUrl() const
 {
 	if (ipfsUrlCached.empty())
-		ipfsUrlCached = "dweb:/ipfs/" + util::ipfsHashBase58(scanner->source());
+		ipfsUrlCached = "dweb:/ipfs/" + util::ipfsHashBase58(string(scanner->source()));
 	return ipfsUrlCached;
 }
 
@@ -1167,7 +1634,10 @@ bool onlySafeExperimentalFeaturesActivated(set<ExperimentalFeature> const& featu
 
 void CompilerStack::compileContract(
 	ContractDefinition const& _contract,
-	map<ContractDefinition const*, shared_ptr<Compiler const>>& _otherCompilers
+	map<ContractDefinition const*, shared_ptr<Compiler const>>& _otherCompilers,
+	ErrorReporter& _errorReporter,
+	size_t _parallelism,
+	bool _regenerateCachedCode
 )
 {
 	solAssert(m_stackState >= AnalysisPerformed, "");
@@ -1178,27 +1648,56 @@ void CompilerStack::compileContract(
 		return;
 
 	for (auto const* dependency: _contract.annotation().contractDependencies)
-		compileContract(*dependency, _otherCompilers);
+		compileContract(*dependency, _otherCompilers, _errorReporter, _parallelism);
 
 	if (!_contract.canBeDeployed())
 		return;
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
+	TimeReport::Stopwatch stopwatch{m_timeReport.get(), "compilation", _contract.fullyQualifiedName()};
 
-	shared_ptr<Compiler> compiler = make_shared<Compiler>(m_evmVersion, m_revertStrings, m_optimiserSettings);
+	optional<util::h256> cacheKey;
+	if (m_cache && !_regenerateCachedCode)
+	{
+		cacheKey = contractCacheKey(compiledContract);
+		// The assembly items are not stored in the cache, so the code is generated if they are needed.
+		if (!m_generateAssemblyItems && loadCachedCode(compiledContract, *cacheKey, true))
+		{
+			stopwatch.lap("codeGenerationCacheHit");
+			_otherCompilers[compiledContract.contract] = nullptr;
+			checkCodeSize(compiledContract, _errorReporter);
+			return;
+		}
+	}
+
+	// The code generator needs the compilers of the dependencies, which do not exist
+	// for dependencies taken from the cache.
+	for (auto const* dependency: _contract.annotation().contractDependencies)
+		if (auto it = _otherCompilers.find(dependency); it != _otherCompilers.end() && !it->second)
+		{
+			_otherCompilers.erase(it);
+			compileContract(*dependency, _otherCompilers, _errorReporter, _parallelism, true);
+		}
+
+	compiledContract.codeFromCache = false;
+	compiledContract.cachedAssembly.clear();
+	compiledContract.cachedAssemblyJSON = Json::Value();
+	shared_ptr<Compiler> compiler = make_shared<Compiler>(m_evmVersion, m_revertStrings, m_optimiserSettings, _parallelism);
 	compiledContract.compiler = compiler;
 
 	bytes cborEncodedMetadata = createCBORMetadata(compiledContract);
 
+	compiler->compileContract(_contract, _otherCompilers, cborEncodedMetadata);
+	stopwatch.lap("codeGeneration");
 	try
 	{
-		// Run optimiser and compile the contract.
-		compiler->compileContract(_contract, _otherCompilers, cborEncodedMetadata);
+		compiler->optimise();
 	}
 	catch(evmasm::OptimizerException const&)
 	{
 		solAssert(false, "Optimizer exception during compilation");
 	}
+	stopwatch.lap("optimization");
 
 	compiledContract.evmAssembly = compiler->assemblyPtr();
 	solAssert(compiledContract.evmAssembly, "");
@@ -1224,24 +1723,34 @@ void CompilerStack::compileContract(
 	{
 		solAssert(false, "Assembly exception for deployed bytecode");
 	}
+	stopwatch.lap("assembly");
 
+	compiledContract.pendingCacheKey = cacheKey;
+
+	// The warnings of regenerated contracts were reported when their code was taken from the cache.
+	if (!_regenerateCachedCode)
+		checkCodeSize(compiledContract, _errorReporter);
+
+	_otherCompilers[compiledContract.contract] = compiler;
+}
+
+void CompilerStack::checkCodeSize(Contract const& _contract, ErrorReporter& _errorReporter) const
+{
 	// Throw a warning if EIP-170 limits are exceeded:
 	//   If contract creation returns data with length greater than 0x6000 (214 + 213) bytes,
 	//   contract creation fails with an out of gas error.
 	if (
 		m_evmVersion >= langutil::EVMVersion::spuriousDragon() &&
-		compiledContract.runtimeObject.bytecode.size() > 0x6000
+		_contract.runtimeObject.bytecode.size() > 0x6000
 	)
-		m_errorReporter.warning(
+		_errorReporter.warning(
 			5574_error,
-			_contract.location(),
+			_contract.contract->location(),
 			"Contract code size exceeds 24576 bytes (a limit introduced in Spurious Dragon). "
 			"This contract may not be deployable on mainnet. "
 			"Consider enabling the optimizer (with a low \"runs\" value!), "
 			"turning off revert strings, or using libraries."
 		);
-
-	_otherCompilers[compiledContract.contract] = compiler;
 }
 
 void CompilerStack::generateIR(ContractDefinition const& _contract)
@@ -1273,11 +1782,183 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 	for (auto const& pair: m_contracts)
 		otherYulSources.emplace(pair.second.contract, pair.second.yulIR);
 
+	TimeReport::Stopwatch stopwatch{m_timeReport.get(), "compilation", _contract.fullyQualifiedName()};
 	IRGenerator generator(m_evmVersion, m_revertStrings, m_optimiserSettings);
-	tie(compiledContract.yulIR, compiledContract.yulIROptimized) = generator.run(_contract, otherYulSources);
+	compiledContract.yulIR = generator.run(_contract, otherYulSources);
+	stopwatch.lap("irGeneration");
+}
+
+void CompilerStack::compileIR(
+	ContractDefinition const& _contract,
+	ErrorReporter& _errorReporter,
+	size_t _parallelism
+)
+{
+	optimizeIR(_contract, _parallelism);
+	if (m_generateEvmBytecode && m_viaIR)
+		generateEVMFromIR(_contract, _errorReporter, _parallelism);
+	if (m_generateEwasm)
+		generateEwasm(_contract, _parallelism);
+}
+
+void CompilerStack::compileConcurrently(vector<PendingCompilation>& _compilations)
+{
+	vector<PendingCompilation> compilations = std::move(_compilations);
+	_compilations.clear();
+	if (compilations.empty())
+		return;
+
+	// Contracts share the assemblies of the contracts they create, which are modified when
+	// they are optimised and assembled. Contracts that have dependencies in common are therefore
+	// compiled by the same task.
+	map<ContractDefinition const*, ContractDefinition const*> groupRepresentative;
+	function<ContractDefinition const*(ContractDefinition const*)> findRepresentative =
+		[&](ContractDefinition const* _contract)
+		{
+			auto [it, inserted] = groupRepresentative.emplace(_contract, _contract);
+			if (!inserted && it->second != _contract)
+				it->second = findRepresentative(it->second);
+			return it->second;
+		};
+	set<ContractDefinition const*> legacyContracts;
+	function<void(ContractDefinition const&)> addWithDependencies = [&](ContractDefinition const& _contract)
+	{
+		if (!legacyContracts.insert(&_contract).second)
+			return;
+		for (auto const* dependency: _contract.annotation().contractDependencies)
+		{
+			addWithDependencies(*dependency);
+			groupRepresentative[findRepresentative(dependency)] = findRepresentative(&_contract);
+		}
+	};
+
+	// Each task consists of the indices of the compilations it performs, in order.
+	vector<vector<size_t>> tasks;
+	map<ContractDefinition const*, size_t> legacyTasks;
+	for (size_t i = 0; i < compilations.size(); ++i)
+		if (compilations[i].legacy)
+			addWithDependencies(*compilations[i].contract);
+	for (size_t i = 0; i < compilations.size(); ++i)
+		if (!compilations[i].legacy)
+			tasks.push_back({i});
+		else
+		{
+			auto [it, inserted] = legacyTasks.emplace(findRepresentative(compilations[i].contract), tasks.size());
+			if (inserted)
+				tasks.emplace_back();
+			tasks[it->second].push_back(i);
+		}
+
+	bool const concurrent = m_parallelism > 1 && tasks.size() > 1;
+	if (concurrent && !legacyContracts.empty())
+	{
+		// The code generator reads the annotations of all sources and the metadata is created
+		// lazily, which both must not happen concurrently.
+		for (Source const* source: m_sourceOrder)
+			if (source->ast)
+				createAnnotations(*source->ast);
+		for (ContractDefinition const* contract: legacyContracts)
+			if (contract->canBeDeployed())
+				metadata(m_contracts.at(contract->fullyQualifiedName()));
+	}
+
+	size_t optimiserParallelism = max<size_t>(1, m_parallelism / tasks.size());
+	vector<ErrorList> warnings(compilations.size());
+	vector<exception_ptr> exceptions(compilations.size());
+	optional<Type::ConcurrentSection> concurrentSection;
+	if (concurrent)
+		concurrentSection.emplace();
+	util::parallelFor(tasks.size(), concurrent ? m_parallelism : 1, [&](size_t _task) {
+		map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
+		for (size_t index: tasks[_task])
+			try
+			{
+				ErrorReporter errorReporter(warnings[index]);
+				if (compilations[index].legacy)
+					compileContract(*compilations[index].contract, otherCompilers, errorReporter, optimiserParallelism);
+				else
+					compileIR(*compilations[index].contract, errorReporter, optimiserParallelism);
+			}
+			catch (...)
+			{
+				// A serial run would have stopped here.
+				exceptions[index] = current_exception();
+				break;
+			}
+	});
+	concurrentSection.reset();
+
+	// A serial run would have stopped at the first failing compilation.
+	auto firstFailure = find_if(exceptions.begin(), exceptions.end(), [](exception_ptr const& _e) { return !!_e; });
+	size_t processedCompilations = compilations.size();
+	if (firstFailure != exceptions.end())
+	{
+		processedCompilations = static_cast<size_t>(firstFailure - exceptions.begin()) + 1;
+		m_errorList.resize(compilations[processedCompilations - 1].errorPosition);
+	}
+
+	// Insert back to front, so that the positions of earlier compilations remain valid.
+	for (size_t i = processedCompilations; i > 0; --i)
+		m_errorList.insert(
+			m_errorList.begin() + static_cast<ptrdiff_t>(compilations[i - 1].errorPosition),
+			warnings[i - 1].begin(),
+			warnings[i - 1].end()
+		);
+
+	if (firstFailure != exceptions.end())
+		rethrow_exception(*firstFailure);
 }
 
-void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
+void CompilerStack::optimizeIR(ContractDefinition const& _contract, size_t _parallelism)
+{
+	solAssert(m_stackState >= AnalysisPerformed, "");
+	if (m_hasError)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Called optimizeIR with errors."));
+
+	if (!_contract.canBeDeployed())
+		return;
+
+	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
+	solAssert(!compiledContract.yulIR.empty(), "");
+	if (!compiledContract.yulIROptimized.empty())
+		return;
+
+	TimeReport::Stopwatch stopwatch{m_timeReport.get(), "compilation", _contract.fullyQualifiedName()};
+	// The profile can only be recorded by actually running the optimizer.
+	optional<util::h256> cacheKey;
+	if (m_cache && !m_profileYulOptimiser)
+	{
+		cacheKey = CompilationCache::key("optimizedIR", {
+			compiledContract.yulIR,
+			m_evmVersion.name(),
+			optimiserSettingsFingerprint(m_optimiserSettings)
+		});
+		optional<string> cachedIR = m_cache->load(*cacheKey);
+		if (cachedIR && !cachedIR->empty())
+		{
+			compiledContract.yulIROptimized = move(*cachedIR);
+			stopwatch.lap("irOptimizationCacheHit");
+			return;
+		}
+	}
+
+	compiledContract.yulIROptimized = IRGenerator::optimize(
+		compiledContract.yulIR,
+		m_evmVersion,
+		m_optimiserSettings,
+		m_profileYulOptimiser ? &compiledContract.yulOptimiserProfile : nullptr,
+		_parallelism
+	);
+	if (cacheKey)
+		m_cache->store(*cacheKey, compiledContract.yulIROptimized);
+	stopwatch.lap("irOptimization");
+}
+
+void CompilerStack::generateEVMFromIR(
+	ContractDefinition const& _contract,
+	ErrorReporter& _errorReporter,
+	size_t _parallelism
+)
 {
 	solAssert(m_stackState >= AnalysisPerformed, "");
 	if (m_hasError)
@@ -1291,20 +1972,39 @@ void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
 	if (!compiledContract.object.bytecode.empty())
 		return;
 
-	// Re-parse the Yul IR in EVM dialect
-	yul::AssemblyStack stack(m_evmVersion, yul::AssemblyStack::Language::StrictAssembly, m_optimiserSettings);
-	stack.parseAndAnalyze("", compiledContract.yulIROptimized);
-	stack.optimize();
-
-	//cout << yul::AsmPrinter{}(*stack.parserResult()->code) << endl;
-
-	// TODO: support passing metadata
-	// TODO: use stack.assemble here!
-	yul::MachineAssemblyObject init;
-	yul::MachineAssemblyObject runtime;
-	std::tie(init, runtime) = stack.assembleAndGuessRuntime();
-	compiledContract.object = std::move(*init.bytecode);
-	compiledContract.runtimeObject = std::move(*runtime.bytecode);
+	TimeReport::Stopwatch stopwatch{m_timeReport.get(), "compilation", _contract.fullyQualifiedName()};
+	// The metadata is not part of the code yet, so the code only depends on the optimized IR.
+	optional<util::h256> cacheKey;
+	if (m_cache)
+		cacheKey = CompilationCache::key("evmFromIR", {
+			compiledContract.yulIROptimized,
+			m_evmVersion.name(),
+			optimiserSettingsFingerprint(m_optimiserSettings)
+		});
+	if (cacheKey && loadCachedCode(compiledContract, *cacheKey, false))
+		stopwatch.lap("evmCodeGenerationFromIRCacheHit");
+	else
+	{
+		// Re-parse the Yul IR in EVM dialect
+		yul::AssemblyStack stack(m_evmVersion, yul::AssemblyStack::Language::StrictAssembly, m_optimiserSettings);
+		stack.setOptimiserParallelism(_parallelism);
+		stack.parseAndAnalyze("", compiledContract.yulIROptimized);
+		stack.optimize();
+		stopwatch.lap("evmDialectOptimization");
+
+		//cout << yul::AsmPrinter{}(*stack.parserResult()->code) << endl;
+
+		// TODO: support passing metadata
+		// TODO: use stack.assemble here!
+		yul::MachineAssemblyObject init;
+		yul::MachineAssemblyObject runtime;
+		std::tie(init, runtime) = stack.assembleAndGuessRuntime();
+		compiledContract.object = std::move(*init.bytecode);
+		compiledContract.runtimeObject = std::move(*runtime.bytecode);
+		if (cacheKey)
+			storeCachedCode(compiledContract, *cacheKey, false);
+		stopwatch.lap("evmCodeGenerationFromIR");
+	}
 	// TODO: refactor assemblyItems, runtimeAssemblyItems, generatedSources,
 	//       assemblyString, assemblyJSON, and functionEntryPoints to work with this code path
 
@@ -1315,7 +2015,7 @@ void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
 		m_evmVersion >= langutil::EVMVersion::spuriousDragon() &&
 		compiledContract.runtimeObject.bytecode.size() > 0x6000
 	)
-		m_errorReporter.warning(
+		_errorReporter.warning(
 			9609_error,
 			_contract.location(),
 			"Contract code size exceeds 24576 bytes (a limit introduced in Spurious Dragon). "
@@ -1325,7 +2025,7 @@ void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
 		);
 }
 
-void CompilerStack::generateEwasm(ContractDefinition const& _contract)
+void CompilerStack::generateEwasm(ContractDefinition const& _contract, size_t _parallelism)
 {
 	solAssert(m_stackState >= AnalysisPerformed, "");
 	if (m_hasError)
@@ -1339,8 +2039,10 @@ void CompilerStack::generateEwasm(ContractDefinition const& _contract)
 	if (!compiledContract.ewasm.empty())
 		return;
 
+	TimeReport::Stopwatch stopwatch{m_timeReport.get(), "compilation", _contract.fullyQualifiedName()};
 	// Re-parse the Yul IR in EVM dialect
 	yul::AssemblyStack stack(m_evmVersion, yul::AssemblyStack::Language::StrictAssembly, m_optimiserSettings);
+	stack.setOptimiserParallelism(_parallelism);
 	stack.parseAndAnalyze("", compiledContract.yulIROptimized);
 
 	stack.optimize();
@@ -1353,6 +2055,7 @@ void CompilerStack::generateEwasm(ContractDefinition const& _contract)
 	auto result = stack.assemble(yul::AssemblyStack::Machine::Ewasm);
 	compiledContract.ewasm = std::move(result.assembly);
 	compiledContract.ewasmObject = std::move(*result.bytecode);
+	stopwatch.lap("ewasmGeneration");
 }
 
 CompilerStack::Contract const& CompilerStack::contract(string const& _contractName) const
@@ -1419,7 +2122,7 @@ string CompilerStack::createMetadata(Contract const& _contract) const
 		if (optional<string> licenseString = s.second.ast->licenseString())
 			meta["sources"][s.first]["license"] = *licenseString;
 		if (m_metadataLiteralSources)
-			meta["sources"][s.first]["content"] = s.second.scanner->source();
+			meta["sources"][s.first]["content"] = string(s.second.scanner->source());
 		else
 		{
 			meta["sources"][s.first]["urls"] = Json::arrayValue;
@@ -1577,6 +2280,37 @@ private:
 	bytes m_data;
 };
 
+Json::Value CompilerStack::createGeneratedSources(Contract const& _contract, bool _runtime) const
+{
+	Json::Value sources{Json::arrayValue};
+	// If there is no compiler, then no bytecode was generated and thus no
+	// sources were generated.
+	if (_contract.compiler)
+	{
+		string source =
+			_runtime ?
+			_contract.compiler->runtimeGeneratedYulUtilityCode() :
+			_contract.compiler->generatedYulUtilityCode();
+		if (!source.empty())
+		{
+			string sourceName = CompilerContext::yulUtilityFileName();
+			unsigned sourceIndex = sourceIndices()[sourceName];
+			ErrorList errors;
+			ErrorReporter errorReporter(errors);
+			auto scanner = make_shared<langutil::Scanner>(langutil::CharStream(source, sourceName));
+			yul::EVMDialect const& dialect = yul::EVMDialect::strictAssemblyForEVM(m_evmVersion);
+			shared_ptr<yul::Block> parserResult = yul::Parser{errorReporter, dialect}.parse(scanner, false);
+			solAssert(parserResult, "");
+			sources[0]["ast"] = yul::AsmJsonConverter{sourceIndex}(*parserResult);
+			sources[0]["name"] = sourceName;
+			sources[0]["id"] = sourceIndex;
+			sources[0]["language"] = "Yul";
+			sources[0]["contents"] = move(source);
+		}
+	}
+	return sources;
+}
+
 bytes CompilerStack::createCBORMetadata(Contract const& _contract) const
 {
 	bool const experimentalMode = !onlySafeExperimentalFeaturesActivated(
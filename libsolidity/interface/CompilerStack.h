@@ -24,8 +24,10 @@
 
 #pragma once
 
+#include <libsolidity/interface/CompilationCache.h>
 #include <libsolidity/interface/ReadFile.h>
 #include <libsolidity/interface/OptimiserSettings.h>
+#include <libsolidity/interface/TimeReport.h>
 #include <libsolidity/interface/Version.h>
 #include <libsolidity/interface/DebugSettings.h>
 
@@ -78,6 +80,7 @@ class Compiler;
 class GlobalContext;
 class Natspec;
 class DeclarationContainer;
+class NameAndTypeResolver;
 
 /**
  * Easy to use and self-contained Solidity compiler with as few header dependencies as possible.
@@ -166,6 +169,18 @@ public:
 	/// Must be set before parsing.
 	void setViaIR(bool _viaIR);
 
+	/// Sets the maximum number of threads used for the compilation steps that
+	/// can be performed for several contracts concurrently. The output does
+	/// not depend on this setting.
+	void setParallelism(size_t _parallelism);
+
+	/// Enables a persistent cache for the optimized IR and the generated code in the given directory.
+	/// The optimizer is skipped for contracts whose unoptimized IR was already optimized with
+	/// the same settings and compiler version before, and the code generator is skipped for
+	/// contracts that were compiled from the same sources with the same settings before.
+	/// An empty path disables the cache.
+	void setCacheDirectory(std::string const& _directory);
+
 	/// Set the EVM version used before running compile.
 	/// When called without an argument it will revert to the default version.
 	/// Must be set before parsing.
@@ -188,12 +203,25 @@ public:
 	/// Enable EVM Bytecode generation. This is enabled by default.
 	void enableEvmBytecodeGeneration(bool _enable = true) { m_generateEvmBytecode = _enable; }
 
+	/// Enable the generation of the assembly items, which are needed for the gas estimates.
+	/// This is enabled by default. If disabled, the code of contracts is taken from the cache
+	/// without generating it again, and their assembly items and gas estimates are not available.
+	void enableAssemblyItemGeneration(bool _enable = true) { m_generateAssemblyItems = _enable; }
+
 	/// Enable experimental generation of Yul IR code.
 	void enableIRGeneration(bool _enable = true) { m_generateIR = _enable; }
 
 	/// Enable experimental generation of Ewasm code. If enabled, IR is also generated.
 	void enableEwasmGeneration(bool _enable = true) { m_generateEwasm = _enable; }
 
+	/// Enable recording the run time and effect of the Yul optimiser steps while optimizing the IR.
+	/// If enabled, IR is also generated.
+	void enableYulOptimiserProfiling(bool _enable = true) { m_profileYulOptimiser = _enable; }
+
+	/// Enable recording the time spent in the phases of the compilation, the analysers and the
+	/// code generation steps of every contract. The report covers the most recent compilation.
+	void enableTimeReport(bool _enable = true);
+
 	/// @arg _metadataLiteralSources When true, store sources as literals in the contract metadata.
 	/// Must be set before parsing.
 	void useMetadataLiteralSources(bool _metadataLiteralSources);
@@ -206,6 +234,10 @@ public:
 	/// Sets the sources. Must be set before parsing.
 	void setSources(StringMap _sources);
 
+	/// Sets the sources given as character streams, whose names are the names of the source units.
+	/// The contents of the streams are shared, not copied. Must be set before parsing.
+	void setCharStreams(std::vector<langutil::CharStream> _sources);
+
 	/// Adds a response to an SMTLib2 query (identified by the hash of the query input).
 	/// Must be set before parsing.
 	void addSMTLib2Response(util::h256 const& _hash, std::string const& _response);
@@ -227,6 +259,16 @@ public:
 	/// @returns false on error.
 	bool parseAndAnalyze(State _stopAfter = State::CompilationSuccessful);
 
+	/// Replaces the contents of the given sources (or adds them) after the sources have been parsed
+	/// and repeats parsing and analysis. Only the changed source units and the source units that
+	/// import them (directly or indirectly) are parsed and analysed again, the ASTs and annotations
+	/// of all other source units are reused. Sources cannot be removed this way.
+	/// If the previous analysis did not succeed, everything is parsed and analysed again.
+	/// Compilation results are discarded, compile() has to be called again to re-create them.
+	/// Does nothing if none of the sources changed.
+	/// @returns false on error.
+	bool updateSources(StringMap const& _sources);
+
 	/// Compiles the source units that were previously added and parsed.
 	/// @returns false on error.
 	bool compile(State _stopAfter = State::CompilationSuccessful);
@@ -268,6 +310,14 @@ public:
 	/// @returns the optimized IR representation of a contract.
 	std::string const& yulIROptimized(std::string const& _contractName) const;
 
+	/// @returns the profile of the Yul optimiser steps run on the IR of a contract,
+	/// if enabled via enableYulOptimiserProfiling.
+	Json::Value const& yulOptimiserProfile(std::string const& _contractName) const;
+
+	/// @returns the times recorded during the compilation in microseconds,
+	/// if enabled via enableTimeReport.
+	Json::Value timeReport() const;
+
 	/// @returns the Ewasm text representation of a contract.
 	std::string const& ewasm(std::string const& _contractName) const;
 
@@ -280,10 +330,11 @@ public:
 	/// @returns the runtime object for the contract.
 	evmasm::LinkerObject const& runtimeObject(std::string const& _contractName) const;
 
-	/// @returns normal contract assembly items
+	/// @returns normal contract assembly items or null if the code was taken from the cache
+	/// (see enableAssemblyItemGeneration).
 	evmasm::AssemblyItems const* assemblyItems(std::string const& _contractName) const;
 
-	/// @returns runtime contract assembly items
+	/// @returns runtime contract assembly items or null if the code was taken from the cache.
 	evmasm::AssemblyItems const* runtimeAssemblyItems(std::string const& _contractName) const;
 
 	/// @returns an array containing all utility sources generated during compilation.
@@ -301,7 +352,7 @@ public:
 	/// @return a verbose text representation of the assembly.
 	/// @arg _sourceCodes is the map of input files to source code strings
 	/// Prerequisite: Successful compilation.
-	std::string assemblyString(std::string const& _contractName, StringMap _sourceCodes = StringMap()) const;
+	std::string assemblyString(std::string const& _contractName, StringMap const& _sourceCodes = StringMap()) const;
 
 	/// @returns a JSON representation of the assembly.
 	/// @arg _sourceCodes is the map of input files to source code strings
@@ -364,6 +415,7 @@ private:
 		evmasm::LinkerObject runtimeObject; ///< Runtime object.
 		std::string yulIR; ///< Experimental Yul IR code.
 		std::string yulIROptimized; ///< Optimized experimental Yul IR code.
+		Json::Value yulOptimiserProfile; ///< Run time and effect of the Yul optimiser steps.
 		std::string ewasm; ///< Experimental Ewasm text representation
 		evmasm::LinkerObject ewasmObject; ///< Experimental Ewasm code
 		util::LazyInit<std::string const> metadata; ///< The metadata json that will be hashed into the chain.
@@ -375,6 +427,14 @@ private:
 		util::LazyInit<Json::Value const> runtimeGeneratedSources;
 		mutable std::optional<std::string const> sourceMapping;
 		mutable std::optional<std::string const> runtimeSourceMapping;
+		/// True if the objects were taken from the cache instead of running the code generator.
+		bool codeFromCache = false;
+		/// The assembly text and JSON taken from the cache, only set if codeFromCache is true.
+		std::string cachedAssembly;
+		Json::Value cachedAssemblyJSON;
+		/// The key under which the code generated by the legacy code generator is stored in the
+		/// cache once all contracts are compiled.
+		std::optional<util::h256> pendingCacheKey;
 	};
 
 	/// Loads the missing sources from @a _ast (named @a _path) using the callback
@@ -384,6 +444,25 @@ private:
 	std::string applyRemapping(std::string const& _path, std::string const& _context);
 	void resolveImports();
 
+	/// Parses the given sources and the sources they import that were not loaded yet.
+	/// The IDs of the created AST nodes start after @a _lastNodeID.
+	void parseSources(std::vector<std::string> _sourcesToParse, int64_t _lastNodeID);
+	/// Performs the analysis steps on all sources in m_sourceOrder apart from @a _reusedSources.
+	/// The source units in @a _reusedSources have to be already analysed with the current
+	/// resolver and must only import source units that are also reused.
+	/// @returns false on error.
+	bool analyzeSources(std::set<Source const*> const& _reusedSources);
+	/// Runs @a _check on the ASTs of @a _sources. If more than one thread is allowed, the sources
+	/// are checked concurrently with a separate error reporter each, so @a _check must not modify
+	/// the AST. The errors are appended in the order of @a _sources, so that the error list does
+	/// not depend on the number of threads. If @a _check throws for any of the sources, the
+	/// errors of the sources after the first failing one are discarded and its exception is rethrown.
+	/// @returns false if @a _check returned false for any of the sources.
+	bool checkSources(
+		std::vector<Source const*> const& _sources,
+		std::function<bool(std::shared_ptr<SourceUnit> const&, langutil::ErrorReporter&)> const& _check
+	);
+
 	/// Store the contract definitions in m_contracts.
 	void storeContractDefinitions();
 
@@ -393,30 +472,105 @@ private:
 	/// @returns true if the contract is requested to be compiled.
 	bool isRequestedContract(ContractDefinition const& _contract) const;
 
-	/// Compile a single contract.
+	/// Compile a single contract and the contracts it depends on.
 	/// @param _otherCompilers provides access to compilers of other contracts, to get
 	///                        their bytecode if needed. Only filled after they have been compiled.
+	/// Warnings are reported to @a _errorReporter. The metadata of the contract and its
+	/// dependencies has to be created beforehand if contracts are compiled concurrently.
+	/// The EVM assembly optimiser uses up to @a _parallelism threads for the contract.
+	/// Unless the assembly items are needed, the code is taken from the cache if possible. The
+	/// compilers of such contracts are null in @a _otherCompilers. If @a _regenerateCachedCode
+	/// is true, the code of a contract that was taken from the cache is generated again, without
+	/// reporting the warnings again.
 	void compileContract(
 		ContractDefinition const& _contract,
-		std::map<ContractDefinition const*, std::shared_ptr<Compiler const>>& _otherCompilers
+		std::map<ContractDefinition const*, std::shared_ptr<Compiler const>>& _otherCompilers,
+		langutil::ErrorReporter& _errorReporter,
+		size_t _parallelism = 1,
+		bool _regenerateCachedCode = false
 	);
 
-	/// Generate Yul IR for a single contract.
+	/// Warns if the runtime code of @a _contract exceeds the size limit of EIP-170.
+	void checkCodeSize(Contract const& _contract, langutil::ErrorReporter& _errorReporter) const;
+
+	/// Generate unoptimized Yul IR for a single contract.
 	/// The IR is stored but otherwise unused.
 	void generateIR(ContractDefinition const& _contract);
 
-	/// Generate EVM representation for a single contract.
+	/// Optimize the Yul IR of a single contract and, if requested, translate it to
+	/// EVM and Ewasm. Depends only on the output generated by generateIR for this contract
+	/// and does not access the AST, so it can be run for different contracts concurrently.
+	/// Warnings are reported to @a _errorReporter.
+	/// The Yul optimiser uses up to @a _parallelism threads for the contract.
+	void compileIR(
+		ContractDefinition const& _contract,
+		langutil::ErrorReporter& _errorReporter,
+		size_t _parallelism = 1
+	);
+
+	/// A call of compileIR or compileContract that has been deferred, so that the calls for
+	/// different contracts can be run concurrently.
+	struct PendingCompilation
+	{
+		ContractDefinition const* contract = nullptr;
+		/// Whether compileContract (the legacy code generator) or compileIR is called.
+		bool legacy = false;
+		/// The size of the error list at the point where the call would have been made in a
+		/// serial run.
+		size_t errorPosition = 0;
+	};
+
+	/// Runs the calls in @a _compilations using up to m_parallelism threads.
+	/// Calls of compileIR for different contracts are independent. Calls of compileContract are
+	/// grouped by the contracts they depend on, since contracts share the assemblies of their
+	/// dependencies, and the calls of a group are run in order on one thread.
+	/// The threads not needed for processing different contracts are used by the optimisers
+	/// to process parts of a contract concurrently.
+	/// The warnings of each call are inserted at its error position, so that the resulting
+	/// error list does not depend on the number of threads. If any of the calls throws, the
+	/// errors reported after the position of the first failing call are discarded and its
+	/// exception is rethrown.
+	/// Clears @a _compilations.
+	void compileConcurrently(std::vector<PendingCompilation>& _compilations);
+
+	/// Optimize the Yul IR for a single contract.
 	/// Depends on output generated by generateIR.
-	void generateEVMFromIR(ContractDefinition const& _contract);
+	void optimizeIR(ContractDefinition const& _contract, size_t _parallelism = 1);
+
+	/// Generate EVM representation for a single contract.
+	/// Depends on output generated by optimizeIR.
+	void generateEVMFromIR(
+		ContractDefinition const& _contract,
+		langutil::ErrorReporter& _errorReporter,
+		size_t _parallelism = 1
+	);
 
 	/// Generate Ewasm representation for a single contract.
-	/// Depends on output generated by generateIR.
-	void generateEwasm(ContractDefinition const& _contract);
+	/// Depends on output generated by optimizeIR.
+	void generateEwasm(ContractDefinition const& _contract, size_t _parallelism = 1);
 
 	/// Links all the known library addresses in the available objects. Any unknown
 	/// library will still be kept as an unlinked placeholder in the objects.
 	void link();
 
+	/// @returns the key of the cache entry for the code generated for @a _contract by the
+	/// legacy code generator.
+	util::h256 contractCacheKey(Contract const& _contract) const;
+	/// Stores the objects of @a _contract and, if @a _legacy is true, the outputs derived from its
+	/// assembly in the cache.
+	void storeCachedCode(Contract const& _contract, util::h256 const& _key, bool _legacy) const;
+	/// Stores the code of all contracts generated by the legacy code generator in the cache.
+	/// This happens only after all contracts are compiled, since the optimiser modifies the
+	/// assemblies of created contracts again when it optimises the creating contract.
+	void storePendingCachedCode();
+	/// Loads the objects stored by storeCachedCode into @a _contract.
+	/// @returns false if there is no valid entry.
+	bool loadCachedCode(Contract& _contract, util::h256 const& _key, bool _legacy) const;
+	/// @returns the sources used to print the assembly of the contracts.
+	StringMap assemblySources() const;
+	/// @returns true if @a _sourceCodes are the sources returned by assemblySources.
+	bool isAssemblySources(StringMap const& _sourceCodes) const;
+
 	/// @returns the contract object for the given @a _contractName.
 	/// Can only be called after state is CompilationSuccessful.
 	Contract const& contract(std::string const& _contractName) const;
@@ -435,6 +589,9 @@ private:
 	/// @returns the metadata CBOR for the given serialised metadata JSON.
 	bytes createCBORMetadata(Contract const& _contract) const;
 
+	/// @returns the Yul utility code generated for the contract as a JSON array.
+	Json::Value createGeneratedSources(Contract const& _contract, bool _runtime) const;
+
 	/// @returns the contract ABI as a JSON object.
 	/// This will generate the JSON object and store it in the Contract object if it is not present yet.
 	Json::Value const& contractABI(Contract const&) const;
@@ -467,13 +624,19 @@ private:
 	RevertStrings m_revertStrings = RevertStrings::Default;
 	State m_stopAfter = State::CompilationSuccessful;
 	bool m_viaIR = false;
+	size_t m_parallelism = 1;
+	std::optional<CompilationCache> m_cache;
 	langutil::EVMVersion m_evmVersion;
 	ModelCheckerSettings m_modelCheckerSettings;
 	smtutil::SMTSolverChoice m_enabledSMTSolvers;
 	std::map<std::string, std::set<std::string>> m_requestedContractNames;
 	bool m_generateEvmBytecode = true;
+	bool m_generateAssemblyItems = true;
 	bool m_generateIR = false;
 	bool m_generateEwasm = false;
+	bool m_profileYulOptimiser = false;
+	/// Only set if enabled via enableTimeReport.
+	std::unique_ptr<TimeReport> m_timeReport;
 	std::map<std::string, util::h160> m_libraries;
 	/// list of path prefix remappings, e.g. mylibrary: github.com/ethereum = /usr/local/ethereum
 	/// "context:prefix=target"
@@ -485,6 +648,14 @@ private:
 	std::map<util::h256, std::string> m_smtlib2Responses;
 	std::shared_ptr<GlobalContext> m_globalContext;
 	std::vector<Source const*> m_sourceOrder;
+	/// The resolver used during analysis. Kept so that updateSources() can register
+	/// new source units alongside the reused ones.
+	std::unique_ptr<NameAndTypeResolver> m_resolver;
+	/// Source units replaced by updateSources(). Kept alive until the next reset, since the scopes
+	/// and types created during their analysis are keyed by the addresses of their nodes.
+	std::vector<std::shared_ptr<SourceUnit>> m_retiredSourceUnits;
+	/// Number of entries in m_errorList that were reported before code generation started, if it did.
+	std::optional<size_t> m_analysisErrorCount;
 	std::map<std::string const, Contract> m_contracts;
 	langutil::ErrorList m_errorList;
 	langutil::ErrorReporter m_errorReporter;
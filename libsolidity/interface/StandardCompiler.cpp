@@ -171,7 +171,7 @@ bool hashMatchesContent(string const& _hash, string const& _content)
 
 bool isArtifactRequested(Json::Value const& _outputSelection, string const& _artifact, bool _wildcardMatchesExperimental)
 {
-	static set<string> experimental{"ir", "irOptimized", "wast", "ewasm", "ewasm.wast"};
+	static set<string> experimental{"ir", "irOptimized", "yulOptimizerProfile", "wast", "ewasm", "ewasm.wast"};
 	for (auto const& selectedArtifactJson: _outputSelection)
 	{
 		string const& selectedArtifact = selectedArtifactJson.asString();
@@ -182,7 +182,7 @@ bool isArtifactRequested(Json::Value const& _outputSelection, string const& _art
 			return true;
 		else if (selectedArtifact == "*")
 		{
-			// "ir", "irOptimized", "wast" and "ewasm.wast" can only be matched by "*" if activated.
+			// "ir", "irOptimized", "yulOptimizerProfile", "wast" and "ewasm.wast" can only be matched by "*" if activated.
 			if (experimental.count(_artifact) == 0 || _wildcardMatchesExperimental)
 				return true;
 		}
@@ -255,7 +255,7 @@ bool isBinaryRequested(Json::Value const& _outputSelection)
 	// This does not include "evm.methodIdentifiers" on purpose!
 	static vector<string> const outputsThatRequireBinaries = vector<string>{
 		"*",
-		"ir", "irOptimized",
+		"ir", "irOptimized", "yulOptimizerProfile",
 		"wast", "wasm", "ewasm.wast", "ewasm.wasm",
 		"evm.gasEstimates", "evm.legacyAssembly", "evm.assembly"
 	} + evmObjectComponents("bytecode") + evmObjectComponents("deployedBytecode");
@@ -287,6 +287,19 @@ bool isEvmBytecodeRequested(Json::Value const& _outputSelection)
 	return false;
 }
 
+/// @returns true if the gas estimates were requested, which need the assembly items.
+bool isGasEstimationRequested(Json::Value const& _outputSelection)
+{
+	if (!_outputSelection.isObject())
+		return false;
+
+	for (auto const& fileRequests: _outputSelection)
+		for (auto const& requests: fileRequests)
+			if (isArtifactRequested(requests, "evm.gasEstimates", false))
+				return true;
+	return false;
+}
+
 /// @returns true if any Ewasm code was requested. Note that as an exception, '*' does not
 /// yet match "ewasm.wast" or "ewasm"
 bool isEwasmRequested(Json::Value const& _outputSelection)
@@ -303,11 +316,43 @@ bool isEwasmRequested(Json::Value const& _outputSelection)
 	return false;
 }
 
+/// @returns true if the profile of the Yul optimizer was requested. Note that as an exception,
+/// '*' does not match "yulOptimizerProfile".
+bool isYulOptimizerProfileRequested(Json::Value const& _outputSelection)
+{
+	if (!_outputSelection.isObject())
+		return false;
+
+	for (auto const& fileRequests: _outputSelection)
+		for (auto const& requests: fileRequests)
+			for (auto const& request: requests)
+				if (request == "yulOptimizerProfile")
+					return true;
+
+	return false;
+}
+
+/// @returns true if the time report was requested anywhere in the output selection.
+/// It covers the whole compilation, so it is not matched by '*'.
+bool isTimeReportRequested(Json::Value const& _outputSelection)
+{
+	if (!_outputSelection.isObject())
+		return false;
+
+	for (auto const& fileRequests: _outputSelection)
+		for (auto const& requests: fileRequests)
+			for (auto const& request: requests)
+				if (request == "timeReport")
+					return true;
+
+	return false;
+}
+
 /// @returns true if any Yul IR was requested. Note that as an exception, '*' does not
 /// yet match "ir" or "irOptimized"
 bool isIRRequested(Json::Value const& _outputSelection)
 {
-	if (isEwasmRequested(_outputSelection))
+	if (isEwasmRequested(_outputSelection) || isYulOptimizerProfileRequested(_outputSelection))
 		return true;
 
 	if (!_outputSelection.isObject())
@@ -428,13 +473,13 @@ std::optional<Json::Value> checkAuxiliaryInputKeys(Json::Value const& _input)
 
 std::optional<Json::Value> checkSettingsKeys(Json::Value const& _input)
 {
-	static set<string> keys{"parserErrorRecovery", "debug", "evmVersion", "libraries", "metadata", "modelChecker", "optimizer", "outputSelection", "remappings", "stopAfter", "viaIR"};
+	static set<string> keys{"parserErrorRecovery", "cacheDirectory", "debug", "evmVersion", "libraries", "metadata", "modelChecker", "optimizer", "outputSelection", "parallelism", "remappings", "stopAfter", "viaIR"};
 	return checkKeys(_input, keys, "settings");
 }
 
 std::optional<Json::Value> checkModelCheckerSettingsKeys(Json::Value const& _input)
 {
-	static set<string> keys{"engine", "targets", "timeout"};
+	static set<string> keys{"engine", "solverStrategy", "targets", "timeout"};
 	return checkKeys(_input, keys, "modelChecker");
 }
 
@@ -654,7 +699,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 					"Mismatch between content and supplied hash for \"" + sourceName + "\""
 				));
 			else
-				ret.sources[sourceName] = content;
+				ret.sources[sourceName] = move(content);
 		}
 		else if (sources[sourceName]["urls"].isArray())
 		{
@@ -680,7 +725,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 						));
 					else
 					{
-						ret.sources[sourceName] = result.responseOrErrorMessage;
+						ret.sources[sourceName] = move(result.responseOrErrorMessage);
 						found = true;
 						break;
 					}
@@ -770,6 +815,20 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 		ret.viaIR = settings["viaIR"].asBool();
 	}
 
+	if (settings.isMember("parallelism"))
+	{
+		if (!settings["parallelism"].isUInt() || settings["parallelism"].asUInt() == 0)
+			return formatFatalError("JSONError", "\"settings.parallelism\" must be a positive integer.");
+		ret.parallelism = settings["parallelism"].asUInt();
+	}
+
+	if (settings.isMember("cacheDirectory"))
+	{
+		if (!settings["cacheDirectory"].isString())
+			return formatFatalError("JSONError", "\"settings.cacheDirectory\" must be a string.");
+		ret.cacheDirectory = settings["cacheDirectory"].asString();
+	}
+
 	if (settings.isMember("evmVersion"))
 	{
 		if (!settings["evmVersion"].isString())
@@ -908,6 +967,16 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 		ret.modelCheckerSettings.engine = *engine;
 	}
 
+	if (modelCheckerSettings.isMember("solverStrategy"))
+	{
+		if (!modelCheckerSettings["solverStrategy"].isString())
+			return formatFatalError("JSONError", "settings.modelChecker.solverStrategy must be a string.");
+		std::optional<smtutil::SMTPortfolioStrategy> strategy = solverStrategyFromString(modelCheckerSettings["solverStrategy"].asString());
+		if (!strategy)
+			return formatFatalError("JSONError", "Invalid model checker solver strategy requested.");
+		ret.modelCheckerSettings.solverStrategy = *strategy;
+	}
+
 	if (modelCheckerSettings.isMember("targets"))
 	{
 		if (!modelCheckerSettings["targets"].isString())
@@ -932,11 +1001,17 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 {
 	CompilerStack compilerStack(m_readFile);
 
-	StringMap sourceList = std::move(_inputsAndSettings.sources);
-	compilerStack.setSources(sourceList);
+	vector<CharStream> sources;
+	for (auto& [name, content]: _inputsAndSettings.sources)
+		sources.emplace_back(move(content), name);
+	compilerStack.setCharStreams(sources);
+	// The assembly output needs the input sources as strings. They are only copied if it is requested.
+	optional<StringMap> assemblySources;
 	for (auto const& smtLib2Response: _inputsAndSettings.smtLib2Responses)
 		compilerStack.addSMTLib2Response(smtLib2Response.first, smtLib2Response.second);
 	compilerStack.setViaIR(_inputsAndSettings.viaIR);
+	compilerStack.setParallelism(_inputsAndSettings.parallelism);
+	compilerStack.setCacheDirectory(_inputsAndSettings.cacheDirectory);
 	compilerStack.setEVMVersion(_inputsAndSettings.evmVersion);
 	compilerStack.setParserErrorRecovery(_inputsAndSettings.parserErrorRecovery);
 	compilerStack.setRemappings(_inputsAndSettings.remappings);
@@ -949,8 +1024,11 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 	compilerStack.setModelCheckerSettings(_inputsAndSettings.modelCheckerSettings);
 
 	compilerStack.enableEvmBytecodeGeneration(isEvmBytecodeRequested(_inputsAndSettings.outputSelection));
+	compilerStack.enableAssemblyItemGeneration(isGasEstimationRequested(_inputsAndSettings.outputSelection));
 	compilerStack.enableIRGeneration(isIRRequested(_inputsAndSettings.outputSelection));
 	compilerStack.enableEwasmGeneration(isEwasmRequested(_inputsAndSettings.outputSelection));
+	compilerStack.enableYulOptimiserProfiling(isYulOptimizerProfileRequested(_inputsAndSettings.outputSelection));
+	compilerStack.enableTimeReport(isTimeReportRequested(_inputsAndSettings.outputSelection));
 
 	Json::Value errors = std::move(_inputsAndSettings.errors);
 
@@ -1098,6 +1176,9 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 		for (string const& query: compilerStack.unhandledSMTLib2Queries())
 			output["auxiliaryInputRequested"]["smtlib2queries"]["0x" + util::keccak256(query).hex()] = query;
 
+	if (isTimeReportRequested(_inputsAndSettings.outputSelection))
+		output["timeReport"] = compilerStack.timeReport();
+
 	bool const wildcardMatchesExperimental = false;
 
 	output["sources"] = Json::objectValue;
@@ -1138,6 +1219,8 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 			contractData["ir"] = compilerStack.yulIR(contractName);
 		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "irOptimized", wildcardMatchesExperimental))
 			contractData["irOptimized"] = compilerStack.yulIROptimized(contractName);
+		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "yulOptimizerProfile", wildcardMatchesExperimental))
+			contractData["yulOptimizerProfile"] = compilerStack.yulOptimiserProfile(contractName);
 
 		// Ewasm
 		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "ewasm.wast", wildcardMatchesExperimental))
@@ -1148,7 +1231,15 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 		// EVM
 		Json::Value evmData(Json::objectValue);
 		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.assembly", wildcardMatchesExperimental))
-			evmData["assembly"] = compilerStack.assemblyString(contractName, sourceList);
+		{
+			if (!assemblySources)
+			{
+				assemblySources.emplace();
+				for (CharStream const& source: sources)
+					(*assemblySources)[source.name()] = string(source.source());
+			}
+			evmData["assembly"] = compilerStack.assemblyString(contractName, *assemblySources);
+		}
 		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.legacyAssembly", wildcardMatchesExperimental))
 			evmData["legacyAssembly"] = compilerStack.assemblyJSON(contractName);
 		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.methodIdentifiers", wildcardMatchesExperimental))
@@ -1233,6 +1324,7 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 		AssemblyStack::Language::StrictAssembly,
 		_inputsAndSettings.optimiserSettings
 	);
+	stack.setOptimiserParallelism(_inputsAndSettings.parallelism);
 	string const& sourceName = _inputsAndSettings.sources.begin()->first;
 	string const& sourceContents = _inputsAndSettings.sources.begin()->second;
 
@@ -1269,7 +1361,11 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 	if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, contractName, "ir", wildcardMatchesExperimental))
 		output["contracts"][sourceName][contractName]["ir"] = stack.print();
 
+	bool const profileOptimizer = isYulOptimizerProfileRequested(_inputsAndSettings.outputSelection);
+	stack.enableOptimiserProfiling(profileOptimizer);
 	stack.optimize();
+	if (profileOptimizer && isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, contractName, "yulOptimizerProfile", wildcardMatchesExperimental))
+		output["contracts"][sourceName][contractName]["yulOptimizerProfile"] = stack.optimiserProfile();
 
 	MachineAssemblyObject object;
 	MachineAssemblyObject runtimeObject;
@@ -1319,6 +1415,7 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 Json::Value StandardCompiler::compile(Json::Value const& _input) noexcept
 {
 	YulStringRepository::reset();
+	YulStringRepository::Scope yulStringScope;
 
 	try
 	{
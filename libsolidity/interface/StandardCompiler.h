@@ -73,6 +73,8 @@ private:
 		Json::Value outputSelection;
 		ModelCheckerSettings modelCheckerSettings = ModelCheckerSettings{};
 		bool viaIR = false;
+		size_t parallelism = 1;
+		std::string cacheDirectory;
 	};
 
 	/// Parses the input json (and potentially invokes the read callback) and either returns
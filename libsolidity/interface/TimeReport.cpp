@@ -0,0 +1,85 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Wall time spent in the phases of a compilation.
+ */
+
+#include <libsolidity/interface/TimeReport.h>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::frontend;
+
+TimeReport::Stopwatch::Stopwatch(TimeReport* _report, string _phase, string _contract):
+	m_report(_report),
+	m_phase(move(_phase)),
+	m_contract(move(_contract))
+{
+	if (m_report)
+		m_start = m_lapStart = chrono::steady_clock::now();
+}
+
+TimeReport::Stopwatch::~Stopwatch()
+{
+	if (m_report)
+		m_report->record(m_phase, m_contract, {}, chrono::steady_clock::now() - m_start);
+}
+
+void TimeReport::Stopwatch::lap(string const& _step)
+{
+	if (!m_report)
+		return;
+	auto now = chrono::steady_clock::now();
+	m_report->record(m_phase, m_contract, _step, now - m_lapStart);
+	m_lapStart = now;
+}
+
+void TimeReport::record(
+	string const& _phase,
+	string const& _contract,
+	string const& _step,
+	chrono::steady_clock::duration _time
+)
+{
+	lock_guard<mutex> lock(m_mutex);
+	m_times[{_phase, _contract, _step}] += _time;
+}
+
+void TimeReport::clear()
+{
+	lock_guard<mutex> lock(m_mutex);
+	m_times.clear();
+}
+
+Json::Value TimeReport::toJson() const
+{
+	lock_guard<mutex> lock(m_mutex);
+	Json::Value report{Json::objectValue};
+	for (auto const& [key, time]: m_times)
+	{
+		auto const& [phase, contract, step] = key;
+		Json::Value& phaseReport = report[phase];
+		Json::Value& target = contract.empty() ? phaseReport : phaseReport["contracts"][contract];
+		Json::Value microseconds = Json::Int64(chrono::duration_cast<chrono::microseconds>(time).count());
+		if (step.empty())
+			target["time"] = move(microseconds);
+		else
+			target["steps"][step] = move(microseconds);
+	}
+	return report;
+}
@@ -0,0 +1,90 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Wall time spent in the phases of a compilation.
+ */
+
+#pragma once
+
+#include <json/json.h>
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+namespace solidity::frontend
+{
+
+/**
+ * Records the wall time spent in the phases of a compilation (parsing, analysis, compilation),
+ * in the individual steps of a phase (e.g. the analysers) and in the steps performed for
+ * every contract. Times of repeated measurements of the same step are added up.
+ *
+ * Contracts can be compiled concurrently, so times can be recorded from several threads.
+ */
+class TimeReport
+{
+public:
+	/**
+	 * Measures the time of a phase (or of the part of a phase concerning a contract) from its
+	 * construction to its destruction and of the steps in between, each ending with a call to
+	 * lap(). Does nothing if no report is given.
+	 */
+	class Stopwatch
+	{
+	public:
+		Stopwatch(TimeReport* _report, std::string _phase, std::string _contract = {});
+		~Stopwatch();
+		Stopwatch(Stopwatch const&) = delete;
+		Stopwatch& operator=(Stopwatch const&) = delete;
+
+		/// Records the time since the previous lap (or the start) as the time of @a _step.
+		void lap(std::string const& _step);
+
+	private:
+		TimeReport* m_report = nullptr;
+		std::string m_phase;
+		std::string m_contract;
+		std::chrono::steady_clock::time_point m_start;
+		std::chrono::steady_clock::time_point m_lapStart;
+	};
+
+	/// Adds @a _time to the time of @a _step of @a _phase, or of the phase itself if
+	/// @a _step is empty. If @a _contract is not empty, the time is attributed to that contract.
+	void record(
+		std::string const& _phase,
+		std::string const& _contract,
+		std::string const& _step,
+		std::chrono::steady_clock::duration _time
+	);
+
+	void clear();
+
+	/// @returns the recorded times in microseconds, in the form
+	/// {phase: {"time": ..., "steps": {step: ...}, "contracts": {contract: {"time": ..., "steps": {...}}}}}.
+	Json::Value toJson() const;
+
+private:
+	mutable std::mutex m_mutex;
+	/// Times keyed by phase, contract and step.
+	std::map<std::tuple<std::string, std::string, std::string>, std::chrono::steady_clock::duration> m_times;
+};
+
+}
@@ -1979,7 +1979,7 @@ optional<string> Parser::findLicenseString(std::vector<ASTPointer<ASTNode>> cons
 
 	// Search inside all parts of the source not covered by parsed nodes.
 	// This will leave e.g. "global comments".
-	string const& source = m_scanner->source();
+	string_view source = m_scanner->source();
 	using iter = decltype(source.begin());
 	vector<pair<iter, iter>> sequencesToSearch;
 	sequencesToSearch.emplace_back(source.begin(), source.end());
@@ -1993,7 +1993,7 @@ optional<string> Parser::findLicenseString(std::vector<ASTPointer<ASTNode>> cons
 	vector<string> matches;
 	for (auto const& [start, end]: sequencesToSearch)
 	{
-		smatch match;
+		match_results<iter> match;
 		if (regex_search(start, end, match, licenseRegex))
 		{
 			string license{boost::trim_copy(string(match[1]))};
@@ -38,13 +38,17 @@ namespace solidity::frontend
 class Parser: public langutil::ParserBase
 {
 public:
+	/// @param _lastNodeID the IDs of the created AST nodes start after this value. Used
+	/// to parse sources that are combined with existing ASTs.
 	explicit Parser(
 		langutil::ErrorReporter& _errorReporter,
 		langutil::EVMVersion _evmVersion,
-		bool _errorRecovery = false
+		bool _errorRecovery = false,
+		int64_t _lastNodeID = 0
 	):
 		ParserBase(_errorReporter, _errorRecovery),
-		m_evmVersion(_evmVersion)
+		m_evmVersion(_evmVersion),
+		m_currentNodeID(_lastNodeID)
 	{}
 
 	ASTPointer<SourceUnit> parse(std::shared_ptr<langutil::Scanner> const& _scanner);
@@ -31,6 +31,9 @@
 #if defined(_WIN32)
 #include <windows.h>
 #else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #include <termios.h>
 #endif
@@ -68,6 +71,39 @@ string solidity::util::readFileAsString(string const& _file)
 	return readFile<string>(_file);
 }
 
+MappedFile::MappedFile(string const& _file)
+{
+#if !defined(_WIN32)
+	int fd = open(_file.c_str(), O_RDONLY);
+	assertThrow(fd >= 0, FileNotFound, _file);
+	struct stat status;
+	// Empty files cannot be mapped and other files than regular ones might change their size.
+	if (fstat(fd, &status) == 0 && S_ISREG(status.st_mode) && status.st_size > 0)
+	{
+		size_t size = static_cast<size_t>(status.st_size);
+		void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (mapping != MAP_FAILED)
+		{
+			m_mapping = mapping;
+			m_contents = string_view(static_cast<char const*>(mapping), size);
+		}
+	}
+	close(fd);
+	if (m_mapping)
+		return;
+#endif
+	m_buffer = readFileAsString(_file);
+	m_contents = m_buffer;
+}
+
+MappedFile::~MappedFile()
+{
+#if !defined(_WIN32)
+	if (m_mapping)
+		munmap(m_mapping, m_contents.size());
+#endif
+}
+
 string solidity::util::readStandardInput()
 {
 	string ret;
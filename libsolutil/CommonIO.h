@@ -27,6 +27,7 @@
 #include <libsolutil/Common.h>
 #include <sstream>
 #include <string>
+#include <string_view>
 
 namespace solidity::util
 {
@@ -36,6 +37,27 @@ namespace solidity::util
 /// If the file is empty, returns an empty string.
 std::string readFileAsString(std::string const& _file);
 
+/// Read-only contents of a file. Where supported, the file is mapped into memory instead of
+/// being read, so that its contents are not copied and only loaded when they are accessed.
+/// The file must not be modified while it is mapped.
+class MappedFile
+{
+public:
+	/// If the file doesn't exist, it will throw a FileNotFound exception.
+	explicit MappedFile(std::string const& _file);
+	~MappedFile();
+	MappedFile(MappedFile const&) = delete;
+	MappedFile& operator=(MappedFile const&) = delete;
+
+	std::string_view contents() const noexcept { return m_contents; }
+
+private:
+	std::string_view m_contents;
+	/// Start of the mapping or null if the file was read into m_buffer instead.
+	void* m_mapping = nullptr;
+	std::string m_buffer;
+};
+
 /// Retrieve and returns the contents of standard input (until EOF).
 std::string readStandardInput();
 
@@ -0,0 +1,157 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/Parallel.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <system_error>
+
+using namespace std;
+using namespace solidity::util;
+
+namespace
+{
+
+/// State of a parallelFor call, shared between the calling thread and the helper tasks.
+/// Helper tasks that start after all indices have been handed out return without touching
+/// the task, so the state may outlive the call.
+struct ParallelForState
+{
+	ParallelForState(size_t _count, function<void(size_t)> const& _task):
+		count(_count), task(_task), exceptions(_count)
+	{}
+
+	void run()
+	{
+		size_t processed = 0;
+		for (size_t index = nextIndex++; index < count; index = nextIndex++, ++processed)
+			try
+			{
+				task(index);
+			}
+			catch (...)
+			{
+				exceptions[index] = current_exception();
+			}
+		if (processed == 0)
+			return;
+		lock_guard<mutex> lock(finishedMutex);
+		finished += processed;
+		if (finished == count)
+			allFinished.notify_all();
+	}
+
+	size_t const count;
+	function<void(size_t)> const& task;
+	atomic<size_t> nextIndex{0};
+	vector<exception_ptr> exceptions;
+	mutex finishedMutex;
+	condition_variable allFinished;
+	size_t finished = 0;
+};
+
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		lock_guard<mutex> lock(m_mutex);
+		m_stopping = true;
+	}
+	m_taskAvailable.notify_all();
+	for (thread& t: m_threads)
+		t.join();
+}
+
+ThreadPool& ThreadPool::shared()
+{
+	static ThreadPool pool;
+	return pool;
+}
+
+bool ThreadPool::submit(function<void()> _task)
+{
+	lock_guard<mutex> lock(m_mutex);
+	m_tasks.emplace_back(move(_task));
+	if (m_tasks.size() > m_idleThreads)
+		try
+		{
+			m_threads.emplace_back([this]() { work(); });
+		}
+		catch (system_error const&)
+		{
+			// The task will be picked up by one of the existing threads once it is free.
+			if (m_threads.empty())
+			{
+				m_tasks.pop_back();
+				return false;
+			}
+		}
+	m_taskAvailable.notify_one();
+	return true;
+}
+
+size_t ThreadPool::threadCount() const
+{
+	lock_guard<mutex> lock(m_mutex);
+	return m_threads.size();
+}
+
+void ThreadPool::work()
+{
+	unique_lock<mutex> lock(m_mutex);
+	while (true)
+	{
+		++m_idleThreads;
+		m_taskAvailable.wait(lock, [&]() { return m_stopping || !m_tasks.empty(); });
+		--m_idleThreads;
+		// Remaining tasks are run even if the pool is stopping.
+		if (m_tasks.empty())
+			return;
+		function<void()> task = move(m_tasks.front());
+		m_tasks.pop_front();
+		lock.unlock();
+		task();
+		lock.lock();
+	}
+}
+
+vector<exception_ptr> solidity::util::parallelFor(
+	size_t _count,
+	size_t _jobs,
+	function<void(size_t)> const& _task
+)
+{
+#ifdef __EMSCRIPTEN__
+	// Threads are not available in the emscripten build.
+	_jobs = 1;
+#endif
+
+	auto state = make_shared<ParallelForState>(_count, _task);
+	for (size_t i = 1; i < min(_jobs, _count); ++i)
+		if (!ThreadPool::shared().submit([state]() { state->run(); }))
+			// Continue with the threads that are available.
+			break;
+	state->run();
+
+	unique_lock<mutex> lock(state->finishedMutex);
+	state->allFinished.wait(lock, [&]() { return state->finished == _count; });
+	return move(state->exceptions);
+}
@@ -0,0 +1,94 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Helpers for running independent tasks on multiple threads.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace solidity::util
+{
+
+/**
+ * Set of threads that are kept alive between tasks, so that repeated parallel sections
+ * do not pay for creating and joining threads.
+ *
+ * A new thread is only created if a task is submitted while all threads are busy, so the
+ * number of threads grows to the maximal number of concurrently running tasks.
+ * The threads are joined when the pool is destroyed, after all submitted tasks have run.
+ */
+class ThreadPool
+{
+public:
+	ThreadPool() = default;
+	~ThreadPool();
+	ThreadPool(ThreadPool const&) = delete;
+	ThreadPool& operator=(ThreadPool const&) = delete;
+
+	/// @returns the pool shared by all parallel sections of the compiler.
+	static ThreadPool& shared();
+
+	/// Schedules @a _task to run on one of the threads of the pool.
+	/// The task must not throw.
+	/// @returns false if the task could not be scheduled because no thread is available
+	/// and no new thread could be created.
+	bool submit(std::function<void()> _task);
+
+	/// @returns the number of threads created so far.
+	size_t threadCount() const;
+
+private:
+	void work();
+
+	mutable std::mutex m_mutex;
+	std::condition_variable m_taskAvailable;
+	std::deque<std::function<void()>> m_tasks;
+	std::vector<std::thread> m_threads;
+	size_t m_idleThreads = 0;
+	bool m_stopping = false;
+};
+
+/**
+ * Runs @a _task once for every index in [0, _count) using at most @a _jobs threads
+ * (including the calling thread). The other threads are taken from ThreadPool::shared().
+ * The indices are handed out dynamically, so threads that finish early pick up the
+ * remaining work. Since the calling thread takes part in the work, @a _task may itself
+ * call parallelFor.
+ *
+ * Exceptions do not propagate out of the workers. Instead, the exception thrown
+ * by the task for index i (if any) is stored at position i of the returned vector,
+ * which allows the caller to handle them in a deterministic order.
+ *
+ * If @a _jobs is at most one, all tasks run in order in the calling thread.
+ */
+std::vector<std::exception_ptr> parallelFor(
+	size_t _count,
+	size_t _jobs,
+	std::function<void(size_t)> const& _task
+);
+
+}
@@ -26,7 +26,12 @@
 
 #include <libsolutil/Assertions.h>
 
-#include <regex>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
 
 using namespace std;
 using namespace solidity::util;
@@ -69,162 +74,307 @@ Whiskers& Whiskers::operator()(
 	return *this;
 }
 
-string Whiskers::render() const
+namespace
+{
+
+/// A sequence of text and tags, i.e. a template or the body of a list or condition.
+struct Node;
+struct Sequence
 {
-	return replace(m_template, m_parameters, m_conditions, m_listParameters);
+	/// The text of the sequence, used in error messages.
+	string_view text;
+	vector<Node> nodes;
+};
+
+struct Node
+{
+	enum class Kind { Text, Tag, List, Condition };
+
+	Kind kind = Kind::Text;
+	/// The text of a text node.
+	string_view text;
+	/// The parameter name of a tag, list or condition. Conditions on string
+	/// parameters keep the leading "+".
+	string name;
+	/// The body of a list, or the part of a condition used if it is true.
+	Sequence body;
+	/// The part of a condition used if it is false.
+	Sequence elseBody;
+};
+
+/// A parsed template. The sequences refer to the text owned by the template.
+struct ParsedTemplate
+{
+	string text;
+	Sequence sequence;
+};
+
+bool isParameterChar(char _c)
+{
+	return
+		('a' <= _c && _c <= 'z') ||
+		('A' <= _c && _c <= 'Z') ||
+		('0' <= _c && _c <= '9') ||
+		_c == '_' || _c == '$' || _c == '-';
 }
 
-void Whiskers::checkParameterValid(string const& _parameter) const
+/// @returns the length of the parameter name starting at @a _pos.
+size_t parameterLength(string_view _text, size_t _pos)
 {
-	static regex validParam("^" + paramRegex() + "$");
-	assertThrow(
-		regex_match(_parameter, validParam),
-		WhiskersError,
-		"Parameter" + _parameter + " contains invalid characters."
-	);
+	size_t end = _pos;
+	while (end < _text.size() && isParameterChar(_text[end]))
+		++end;
+	return end - _pos;
 }
 
-void Whiskers::checkParameterUnknown(string const& _parameter) const
+/// @returns the length of the tag "<" + @a _prefix + name + ">" starting at @a _pos
+/// and stores the name in @a _name, or returns zero if there is no such tag.
+size_t openingTagLength(string_view _text, size_t _pos, string_view _prefix, string& _name)
 {
-	assertThrow(
-		!m_parameters.count(_parameter),
-		WhiskersError,
-		_parameter + " already set as value parameter."
-	);
-	assertThrow(
-		!m_conditions.count(_parameter),
-		WhiskersError,
-		_parameter + " already set as condition parameter."
-	);
-	assertThrow(
-		!m_listParameters.count(_parameter),
-		WhiskersError,
-		_parameter + " already set as list parameter."
-	);
+	size_t nameStart = _pos + 1 + _prefix.size();
+	if (nameStart > _text.size() || _text.substr(_pos + 1, _prefix.size()) != _prefix)
+		return 0;
+	size_t nameLength = parameterLength(_text, nameStart);
+	if (nameLength == 0 || nameStart + nameLength >= _text.size() || _text[nameStart + nameLength] != '>')
+		return 0;
+	_name = string(_text.substr(nameStart, nameLength));
+	return nameStart + nameLength + 1 - _pos;
 }
 
-void Whiskers::checkTemplateContainsTags(string const& _parameter, vector<string> const& _prefixes) const
+Sequence parse(string_view _text);
+
+/// Parses the element starting with the "<" at @a _pos.
+/// Lists and conditions extend to the first matching closing tag and are not nested
+/// into elements of the same name.
+/// @returns the element and its end position, or nullopt if there is none, in which
+/// case the "<" is part of the text.
+optional<pair<Node, size_t>> parseElement(string_view _text, size_t _pos)
 {
-	for (auto const& prefix: _prefixes)
+	Node node;
+	if (size_t length = openingTagLength(_text, _pos, "", node.name))
 	{
-		string tag{"<" + prefix + _parameter + ">"};
-		assertThrow(
-			m_template.find(tag) != string::npos,
-			WhiskersError,
-			"Tag '" + tag + "' not found in template:\n" + m_template
-		);
+		node.kind = Node::Kind::Tag;
+		return {{move(node), _pos + length}};
 	}
-}
 
-namespace
-{
-template<class ReplaceCallback>
-string regex_replace(
-	string const& _source,
-	regex const& _pattern,
-	ReplaceCallback _replace,
-	regex_constants::match_flag_type _flags = regex_constants::match_default
-)
-{
-	sregex_iterator curMatch(_source.begin(), _source.end(), _pattern, _flags);
-	sregex_iterator matchEnd;
-	string::const_iterator lastMatchedPos(_source.cbegin());
-	string result;
-	while (curMatch != matchEnd)
+	size_t length = openingTagLength(_text, _pos, "#", node.name);
+	if (length)
+		node.kind = Node::Kind::List;
+	else if ((length = openingTagLength(_text, _pos, "?+", node.name)))
+	{
+		node.kind = Node::Kind::Condition;
+		node.name = "+" + node.name;
+	}
+	else if ((length = openingTagLength(_text, _pos, "?", node.name)))
+		node.kind = Node::Kind::Condition;
+	else
+		return nullopt;
+
+	size_t bodyStart = _pos + length;
+	string closingTag = "</" + node.name + ">";
+	size_t bodyEnd = _text.find(closingTag, bodyStart);
+	if (bodyEnd == string_view::npos)
+		return nullopt;
+	if (node.kind == Node::Kind::List)
+	{
+		node.body = parse(_text.substr(bodyStart, bodyEnd - bodyStart));
+		return {{move(node), bodyEnd + closingTag.size()}};
+	}
+
+	string elseTag = "<!" + node.name + ">";
+	size_t elseStart = _text.substr(0, bodyEnd).find(elseTag, bodyStart);
+	if (elseStart == string_view::npos)
+		node.body = parse(_text.substr(bodyStart, bodyEnd - bodyStart));
+	else
 	{
-		result.append(curMatch->prefix().first, curMatch->prefix().second);
-		result.append(_replace(*curMatch));
-		lastMatchedPos = (*curMatch)[0].second;
-		++curMatch;
+		node.body = parse(_text.substr(bodyStart, elseStart - bodyStart));
+		elseStart += elseTag.size();
+		node.elseBody = parse(_text.substr(elseStart, bodyEnd - elseStart));
 	}
-	result.append(lastMatchedPos, _source.cend());
-	return result;
+	return {{move(node), bodyEnd + closingTag.size()}};
+}
+
+Sequence parse(string_view _text)
+{
+	Sequence sequence{_text, {}};
+	size_t textStart = 0;
+	auto addText = [&](size_t _end) {
+		if (_end > textStart)
+		{
+			Node node;
+			node.text = _text.substr(textStart, _end - textStart);
+			sequence.nodes.emplace_back(move(node));
+		}
+	};
+	for (size_t pos = _text.find('<'); pos != string_view::npos; pos = _text.find('<', pos))
+		if (auto element = parseElement(_text, pos))
+		{
+			addText(pos);
+			sequence.nodes.emplace_back(move(element->first));
+			pos = textStart = element->second;
+		}
+		else
+			++pos;
+	addText(_text.size());
+	return sequence;
 }
+
+/// @returns the parsed form of @a _template. Templates are mostly string literals that are
+/// rendered many times, so the parsed templates are cached by their text.
+shared_ptr<ParsedTemplate const> parsedTemplate(string const& _template)
+{
+	// Limits the memory used by templates that are assembled at run time.
+	size_t const maxCachedTemplates = 4096;
+	static mutex cacheMutex;
+	static unordered_map<string_view, shared_ptr<ParsedTemplate const>> cache;
+
+	lock_guard<mutex> lock(cacheMutex);
+	if (auto it = cache.find(_template); it != cache.end())
+		return it->second;
+
+	if (cache.size() >= maxCachedTemplates)
+		cache.clear();
+	auto parsed = make_shared<ParsedTemplate>();
+	parsed->text = _template;
+	parsed->sequence = parse(parsed->text);
+	cache.emplace(parsed->text, parsed);
+	return parsed;
 }
 
-string Whiskers::replace(
-	string const& _template,
-	StringMap const& _parameters,
-	map<string, bool> const& _conditions,
-	map<string, vector<StringMap>> const& _listParameters
-)
+/// The values available while rendering a sequence. Inside of a list, the values of the
+/// current list element are available in addition to the regular parameters, but no lists.
+struct RenderContext
 {
-	static regex listOrTag(
-		"<(" + paramRegex() + ")>|"
-		"<#(" + paramRegex() + ")>((?:.|\\r|\\n)*?)</\\2>|"
-		"<\\?(\\+?" + paramRegex() + ")>((?:.|\\r|\\n)*?)(<!\\4>((?:.|\\r|\\n)*?))?</\\4>"
-	);
-	return regex_replace(_template, listOrTag, [&](match_results<string::const_iterator> _match) -> string
+	Whiskers::StringMap const& parameters;
+	Whiskers::StringMap const* listElement;
+	map<string, bool> const& conditions;
+	Whiskers::StringListMap const* listParameters;
+
+	string const* parameter(string const& _name) const
 	{
-		string tagName(_match[1]);
-		string listName(_match[2]);
-		string conditionName(_match[4]);
-		if (!tagName.empty())
+		if (listElement)
+			if (auto it = listElement->find(_name); it != listElement->end())
+				return &it->second;
+		if (auto it = parameters.find(_name); it != parameters.end())
+			return &it->second;
+		return nullptr;
+	}
+};
+
+void renderSequence(Sequence const& _sequence, RenderContext const& _context, string& _output)
+{
+	for (Node const& node: _sequence.nodes)
+		switch (node.kind)
+		{
+		case Node::Kind::Text:
+			_output += node.text;
+			break;
+		case Node::Kind::Tag:
 		{
+			string const* value = _context.parameter(node.name);
 			assertThrow(
-				_parameters.count(tagName),
+				value,
 				WhiskersError,
-				"Value for tag " + tagName + " not provided.\n" +
+				"Value for tag " + node.name + " not provided.\n" +
 				"Template:\n" +
-				_template
+				string(_sequence.text)
 			);
-			return _parameters.at(tagName);
+			_output += *value;
+			break;
 		}
-		else if (!listName.empty())
+		case Node::Kind::List:
 		{
-			string templ(_match[3]);
 			assertThrow(
-				_listParameters.count(listName),
-				WhiskersError, "List parameter " + listName + " not set."
+				_context.listParameters && _context.listParameters->count(node.name),
+				WhiskersError, "List parameter " + node.name + " not set."
 			);
-			string replacement;
-			for (auto const& parameters: _listParameters.at(listName))
-				replacement += replace(templ, joinMaps(_parameters, parameters), _conditions);
-			return replacement;
+			for (Whiskers::StringMap const& element: _context.listParameters->at(node.name))
+			{
+				for (auto const& value: element)
+					assertThrow(
+						!_context.parameters.count(value.first),
+						WhiskersError,
+						"Parameter collision"
+					);
+				renderSequence(node.body, {_context.parameters, &element, _context.conditions, nullptr}, _output);
+			}
+			break;
 		}
-		else
+		case Node::Kind::Condition:
 		{
-			assertThrow(!conditionName.empty(), WhiskersError, "");
 			bool conditionValue = false;
-			if (conditionName[0] == '+')
+			if (node.name[0] == '+')
 			{
-				string tag = conditionName.substr(1);
+				string tag = node.name.substr(1);
+				string const* value = _context.parameter(tag);
 				assertThrow(
-					_parameters.count(tag),
+					value,
 					WhiskersError, "Tag " + tag + " used as condition but was not set."
 				);
-				conditionValue = !_parameters.at(tag).empty();
+				conditionValue = !value->empty();
 			}
 			else
 			{
 				assertThrow(
-					_conditions.count(conditionName),
-					WhiskersError, "Condition parameter " + conditionName + " not set."
+					_context.conditions.count(node.name),
+					WhiskersError, "Condition parameter " + node.name + " not set."
 				);
-				conditionValue = _conditions.at(conditionName);
+				conditionValue = _context.conditions.at(node.name);
 			}
-			return replace(
-				conditionValue ? _match[5] : _match[7],
-				_parameters,
-				_conditions,
-				_listParameters
-			);
+			renderSequence(conditionValue ? node.body : node.elseBody, _context, _output);
+			break;
+		}
 		}
-	});
 }
 
-Whiskers::StringMap Whiskers::joinMaps(
-	Whiskers::StringMap const& _a,
-	Whiskers::StringMap const& _b
-)
+}
+
+string Whiskers::render() const
 {
-	Whiskers::StringMap ret = _a;
-	for (auto const& x: _b)
+	shared_ptr<ParsedTemplate const> parsed = parsedTemplate(m_template);
+	string output;
+	output.reserve(m_template.size());
+	renderSequence(parsed->sequence, {m_parameters, nullptr, m_conditions, &m_listParameters}, output);
+	return output;
+}
+
+void Whiskers::checkParameterValid(string const& _parameter) const
+{
+	assertThrow(
+		!_parameter.empty() && all_of(_parameter.begin(), _parameter.end(), isParameterChar),
+		WhiskersError,
+		"Parameter" + _parameter + " contains invalid characters."
+	);
+}
+
+void Whiskers::checkParameterUnknown(string const& _parameter) const
+{
+	assertThrow(
+		!m_parameters.count(_parameter),
+		WhiskersError,
+		_parameter + " already set as value parameter."
+	);
+	assertThrow(
+		!m_conditions.count(_parameter),
+		WhiskersError,
+		_parameter + " already set as condition parameter."
+	);
+	assertThrow(
+		!m_listParameters.count(_parameter),
+		WhiskersError,
+		_parameter + " already set as list parameter."
+	);
+}
+
+void Whiskers::checkTemplateContainsTags(string const& _parameter, vector<string> const& _prefixes) const
+{
+	for (auto const& prefix: _prefixes)
+	{
+		string tag{"<" + prefix + _parameter + ">"};
 		assertThrow(
-			ret.insert(x).second,
+			m_template.find(tag) != string::npos,
 			WhiskersError,
-			"Parameter collision"
+			"Tag '" + tag + "' not found in template:\n" + m_template
 		);
-	return ret;
+	}
 }
-
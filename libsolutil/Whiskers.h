@@ -66,6 +66,10 @@ DEV_SIMPLE_EXCEPTION(WhiskersError);
  *  - List parameter: <#list>...</list>
  *    The part between the tags is repeated as often as values are provided
  *    in the mapping. Each list element can have its own parameter -> value mapping.
+ *
+ * Parameter names consist of the characters a-z, A-Z, 0-9, "_", "$" and "-".
+ * Text that does not form one of the elements is copied to the output unchanged.
+ * Templates are parsed only once, the parsed form is cached by the template text.
  */
 class Whiskers
 {
@@ -100,18 +104,6 @@ private:
 	///        like `"<" + element + _parameter + ">"`. Each element of _prefixes is used as a prefix of the tag name.
 	void checkTemplateContainsTags(std::string const& _parameter, std::vector<std::string> const& _prefixes) const;
 
-	static std::string replace(
-		std::string const& _template,
-		StringMap const& _parameters,
-		std::map<std::string, bool> const& _conditions,
-		StringListMap const& _listParameters = StringListMap()
-	);
-
-	static std::string paramRegex() { return "[a-zA-Z0-9_$-]+"; }
-
-	/// Joins the two maps throwing an exception if two keys are equal.
-	static StringMap joinMaps(StringMap const& _a, StringMap const& _b);
-
 	std::string m_template;
 	StringMap m_parameters;
 	std::map<std::string, bool> m_conditions;
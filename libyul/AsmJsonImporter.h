@@ -38,7 +38,8 @@ namespace solidity::yul
 class AsmJsonImporter
 {
 public:
-	explicit AsmJsonImporter(std::string _sourceName) : m_sourceName(std::move(_sourceName)) {}
+	/// @param _source stream that carries the name of the source the imported locations refer to.
+	explicit AsmJsonImporter(std::shared_ptr<langutil::CharStream> _source): m_source(std::move(_source)) {}
 	yul::Block createBlock(Json::Value const& _node);
 
 private:
@@ -70,7 +71,7 @@ private:
 	yul::Break createBreak(Json::Value const& _node);
 	yul::Continue createContinue(Json::Value const& _node);
 
-	std::string m_sourceName;
+	std::shared_ptr<langutil::CharStream> m_source;
 
 };
 
@@ -81,6 +81,7 @@ bool AssemblyStack::parseAndAnalyze(std::string const& _sourceName, std::string
 {
 	m_errors.clear();
 	m_analysisSuccessful = false;
+	m_optimiserProfiles.clear();
 	m_scanner = make_shared<Scanner>(CharStream(_source, _sourceName));
 	m_parserResult = ObjectParser(m_errorReporter, languageToDialect(m_language, m_evmVersion)).parse(m_scanner, false);
 	if (!m_errorReporter.errors().empty())
@@ -104,6 +105,14 @@ void AssemblyStack::optimize()
 	yulAssert(analyzeParsed(), "Invalid source code after optimization.");
 }
 
+Json::Value AssemblyStack::optimiserProfile() const
+{
+	Json::Value profiles(Json::objectValue);
+	for (auto const& [objectName, profile]: m_optimiserProfiles)
+		profiles[objectName] = profile.toJson();
+	return profiles;
+}
+
 void AssemblyStack::translate(AssemblyStack::Language _targetLanguage)
 {
 	if (m_language == _targetLanguage)
@@ -185,7 +194,10 @@ void AssemblyStack::optimize(Object& _object, bool _isCreation)
 		meter.get(),
 		_object,
 		m_optimiserSettings.optimizeStackAllocation,
-		m_optimiserSettings.yulOptimiserSteps
+		m_optimiserSettings.yulOptimiserSteps,
+		{},
+		m_profileOptimiser ? &m_optimiserProfiles[_object.name.str()] : nullptr,
+		m_optimiserParallelism
 	);
 }
 
@@ -27,11 +27,13 @@
 
 #include <libyul/Object.h>
 #include <libyul/ObjectParser.h>
+#include <libyul/optimiser/OptimiserProfile.h>
 
 #include <libsolidity/interface/OptimiserSettings.h>
 
 #include <libevmasm/LinkerObject.h>
 
+#include <map>
 #include <memory>
 #include <string>
 
@@ -83,6 +85,15 @@ public:
 	/// If the settings (see constructor) disabled the optimizer, nothing is done here.
 	void optimize();
 
+	/// Sets the maximum number of threads used by optimize() to optimise different
+	/// functions concurrently. The result does not depend on this setting.
+	void setOptimiserParallelism(size_t _parallelism) { m_optimiserParallelism = _parallelism; }
+
+	/// Enables recording the run time and the effect of the optimiser steps in optimize().
+	void enableOptimiserProfiling(bool _enable = true) { m_profileOptimiser = _enable; }
+	/// @returns the optimiser profiles recorded by optimize(), keyed by object name.
+	Json::Value optimiserProfile() const;
+
 	/// Translate the source to a different language / dialect.
 	void translate(Language _targetLanguage);
 
@@ -124,6 +135,10 @@ private:
 	langutil::ErrorReporter m_errorReporter;
 
 	std::unique_ptr<std::string> m_sourceMappings;
+
+	size_t m_optimiserParallelism = 1;
+	bool m_profileOptimiser = false;
+	std::map<std::string, OptimiserProfile> m_optimiserProfiles;
 };
 
 }
@@ -0,0 +1,172 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * String abstraction that avoids copies.
+ */
+
+#include <libyul/YulString.h>
+
+#include <libyul/Exceptions.h>
+
+#include <cstring>
+
+using namespace std;
+using namespace solidity::yul;
+
+YulStringRepository::Scope::Scope()
+{
+	YulStringRepository& repository = instance();
+	lock_guard<mutex> lock(repository.m_scopeMutex);
+	++repository.m_activeScopes;
+}
+
+YulStringRepository::Scope::~Scope()
+{
+	YulStringRepository& repository = instance();
+	lock_guard<mutex> lock(repository.m_scopeMutex);
+	if (--repository.m_activeScopes == 0 && repository.m_resetPending)
+	{
+		repository.m_resetPending = false;
+		repository.clear();
+	}
+}
+
+YulStringRepository::Handle YulStringRepository::stringToHandle(string_view _string)
+{
+	if (_string.empty())
+		return { 0, emptyHash() };
+	uint64_t h = lookupHash(_string);
+	size_t shardIndex = static_cast<size_t>(h >> (64 - c_shardBits));
+	Shard& shard = m_shards[shardIndex];
+
+	lock_guard<mutex> lock(shard.mutex);
+	auto range = shard.hashToIndex.equal_range(h);
+	for (auto it = range.first; it != range.second; ++it)
+	{
+		Entry const& entry = shard.strings.at(it->second);
+		if (entry.string == _string)
+			return Handle{(it->second << c_shardBits) | shardIndex, entry.hash};
+	}
+	uint64_t orderingHash = hash(_string);
+	size_t index = shard.strings.append(_string, orderingHash);
+	yulAssert((index << c_shardBits) >> c_shardBits == index, "Too many YulStrings.");
+	shard.hashToIndex.emplace_hint(range.second, make_pair(h, index));
+
+	return Handle{(index << c_shardBits) | shardIndex, orderingHash};
+}
+
+uint64_t YulStringRepository::lookupHash(string_view _string)
+{
+	// Multiply-xorshift mixing in the style of xxHash / MurmurHash3.
+	uint64_t constexpr prime1 = 0x9E3779B185EBCA87u;
+	uint64_t constexpr prime2 = 0xC2B2AE3D27D4EB4Fu;
+	auto mix = [&](uint64_t _hash, uint64_t _word) {
+		_hash ^= _word * prime2;
+		_hash = (_hash << 31) | (_hash >> 33);
+		return _hash * prime1;
+	};
+
+	uint64_t h = _string.size() * prime1;
+	char const* data = _string.data();
+	size_t remaining = _string.size();
+	for (; remaining >= 8; data += 8, remaining -= 8)
+	{
+		uint64_t word;
+		memcpy(&word, data, 8);
+		h = mix(h, word);
+	}
+	if (remaining > 0)
+	{
+		uint64_t word = 0;
+		memcpy(&word, data, remaining);
+		h = mix(h, word);
+	}
+
+	h ^= h >> 33;
+	h *= prime2;
+	h ^= h >> 29;
+	h *= prime1;
+	h ^= h >> 32;
+	return h;
+}
+
+void YulStringRepository::reset()
+{
+	YulStringRepository& repository = instance();
+	lock_guard<mutex> lock(repository.m_scopeMutex);
+	if (repository.m_activeScopes > 0)
+		repository.m_resetPending = true;
+	else
+		repository.clear();
+}
+
+YulStringRepository::ResetCallback::ResetCallback(function<void()> _fun)
+{
+	lock_guard<mutex> lock(resetCallbacksMutex());
+	YulStringRepository::resetCallbacks().emplace_back(move(_fun));
+}
+
+size_t YulStringRepository::StringArena::append(string_view _string, uint64_t _hash)
+{
+	size_t index = m_size;
+	size_t position = index + c_firstBlockSize;
+	size_t block = 0;
+	while ((c_firstBlockSize << (block + 1)) <= position)
+		++block;
+	size_t offset = position - (c_firstBlockSize << block);
+	if (offset == 0)
+	{
+		yulAssert(block < m_blocks.size(), "Too many YulStrings.");
+		if (!m_blocks[block])
+			m_blocks[block] = make_unique<Entry[]>(c_firstBlockSize << block);
+	}
+	m_blocks[block][offset] = Entry{string(_string), _hash};
+	++m_size;
+	return index;
+}
+
+void YulStringRepository::StringArena::clear()
+{
+	for (auto& block: m_blocks)
+		block.reset();
+	m_size = 0;
+}
+
+YulStringRepository::YulStringRepository()
+{
+	// The empty string always has ID zero, i.e. index zero in the first shard.
+	m_shards[0].strings.append({}, emptyHash());
+}
+
+void YulStringRepository::clear()
+{
+	{
+		lock_guard<mutex> lock(resetCallbacksMutex());
+		for (auto const& cb: resetCallbacks())
+			cb();
+	}
+	for (Shard& shard: m_shards)
+	{
+		lock_guard<mutex> lock(shard.mutex);
+		shard.hashToIndex.clear();
+		shard.strings.clear();
+		// The empty string always has ID zero, i.e. index zero in the first shard.
+		if (&shard == &m_shards[0])
+			shard.strings.append({}, emptyHash());
+	}
+}
@@ -23,10 +23,14 @@
 
 #include <boost/noncopyable.hpp>
 
+#include <array>
+#include <cstdint>
 #include <unordered_map>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <functional>
 
 namespace solidity::yul
@@ -36,6 +40,10 @@ namespace solidity::yul
 /// Owns the string data for all YulStrings, which can be referenced by a Handle.
 /// A Handle consists of an ID (that depends on the insertion order of YulStrings and is potentially
 /// non-deterministic) and a deterministic string hash.
+///
+/// The repository can be accessed from multiple threads concurrently. The strings are
+/// distributed over several shards by their hash, each with its own lock, and looking up
+/// the string of an existing handle does not require a lock at all.
 class YulStringRepository
 {
 public:
@@ -45,32 +53,33 @@ public:
 		std::uint64_t hash;
 	};
 
+	/// Marks a compilation that creates or uses YulStrings and can run concurrently with others.
+	/// While at least one scope is active, reset() does not clear the repository, but defers
+	/// the request until the last active scope has ended.
+	class Scope: boost::noncopyable
+	{
+	public:
+		Scope();
+		~Scope();
+	};
+
 	static YulStringRepository& instance()
 	{
 		static YulStringRepository inst;
 		return inst;
 	}
 
-	Handle stringToHandle(std::string const& _string)
+	Handle stringToHandle(std::string_view _string);
+	std::string const& idToString(size_t _id) const
 	{
-		if (_string.empty())
-			return { 0, emptyHash() };
-		std::uint64_t h = hash(_string);
-		auto range = m_hashToID.equal_range(h);
-		for (auto it = range.first; it != range.second; ++it)
-			if (*m_strings[it->second] == _string)
-				return Handle{it->second, h};
-		m_strings.emplace_back(std::make_shared<std::string>(_string));
-		size_t id = m_strings.size() - 1;
-		m_hashToID.emplace_hint(range.second, std::make_pair(h, id));
-
-		return Handle{id, h};
+		return m_shards[_id & (c_shardCount - 1)].strings.at(_id >> c_shardBits).string;
 	}
-	std::string const& idToString(size_t _id) const	{ return *m_strings.at(_id); }
 
-	static std::uint64_t hash(std::string const& v)
+	/// Deterministic FNV hash that is part of the handle and determines the order of YulStrings.
+	/// Replacing it changes the compiler output, so it is only computed once per distinct
+	/// string and the repository uses lookupHash() to find existing strings.
+	static std::uint64_t hash(std::string_view v)
 	{
-		// FNV hash - can be replaced by a better one, e.g. xxhash64
 		std::uint64_t hash = emptyHash();
 		for (char c: v)
 		{
@@ -81,41 +90,93 @@ public:
 		return hash;
 	}
 	static constexpr std::uint64_t emptyHash() { return 14695981039346656037u; }
+	/// Hash used to look up strings in the repository. It processes eight bytes at a time,
+	/// but depends on the byte order of the platform and thus must not influence the output.
+	static std::uint64_t lookupHash(std::string_view _string);
 	/// Clear the repository.
 	/// Use with care - there cannot be any dangling YulString references.
 	/// If references need to be cleared manually, register the callback via
 	/// resetCallback.
-	static void reset()
-	{
-		for (auto const& cb: resetCallbacks())
-			cb();
-		instance() = YulStringRepository{};
-	}
+	/// If a Scope is active, the repository is only cleared once the last active scope ends.
+	static void reset();
 	/// Struct that registers a reset callback as a side-effect of its construction.
 	/// Useful as static local variable to register a reset callback once.
 	struct ResetCallback
 	{
-		ResetCallback(std::function<void()> _fun)
+		ResetCallback(std::function<void()> _fun);
+	};
+
+private:
+	/// Number of low bits of an ID that select the shard.
+	static constexpr size_t c_shardBits = 4;
+	static constexpr size_t c_shardCount = size_t(1) << c_shardBits;
+
+	struct Entry
+	{
+		std::string string;
+		/// The result of hash() for the string.
+		std::uint64_t hash = emptyHash();
+	};
+
+	/// Append-only storage for the strings of a shard.
+	/// The strings are stored in blocks of doubling size that are never moved, so that
+	/// existing strings can be read without locking while other threads add new ones.
+	class StringArena
+	{
+	public:
+		/// Stores a copy of @a _string and returns its index. Requires external synchronisation.
+		size_t append(std::string_view _string, std::uint64_t _hash);
+		Entry const& at(size_t _index) const
 		{
-			YulStringRepository::resetCallbacks().emplace_back(std::move(_fun));
+			size_t position = _index + c_firstBlockSize;
+			size_t block = 0;
+			while ((c_firstBlockSize << (block + 1)) <= position)
+				++block;
+			return m_blocks[block][position - (c_firstBlockSize << block)];
 		}
+		/// Removes all strings. Requires external synchronisation.
+		void clear();
+
+	private:
+		static constexpr size_t c_firstBlockSize = 64;
+
+		std::array<std::unique_ptr<Entry[]>, sizeof(size_t) * 8> m_blocks;
+		size_t m_size = 0;
 	};
 
-private:
-	YulStringRepository() = default;
+	struct Shard
+	{
+		/// Guards the lookup table and additions to the string storage.
+		std::mutex mutex;
+		/// Maps the lookup hash to the indices of the strings.
+		std::unordered_multimap<std::uint64_t, size_t> hashToIndex;
+		StringArena strings;
+	};
+
+	YulStringRepository();
 	YulStringRepository(YulStringRepository const&) = delete;
-	YulStringRepository(YulStringRepository&&) = default;
 	YulStringRepository& operator=(YulStringRepository const& _rhs) = delete;
-	YulStringRepository& operator=(YulStringRepository&& _rhs) = default;
+
+	/// Invokes the reset callbacks and removes all strings apart from the empty string.
+	void clear();
 
 	static std::vector<std::function<void()>>& resetCallbacks()
 	{
 		static std::vector<std::function<void()>> callbacks;
 		return callbacks;
 	}
+	static std::mutex& resetCallbacksMutex()
+	{
+		static std::mutex mutex;
+		return mutex;
+	}
+
+	std::array<Shard, c_shardCount> m_shards;
 
-	std::vector<std::shared_ptr<std::string>> m_strings = {std::make_shared<std::string>()};
-	std::unordered_multimap<std::uint64_t, size_t> m_hashToID = {{emptyHash(), 0}};
+	/// Guards the number of active scopes and the pending reset.
+	std::mutex m_scopeMutex;
+	size_t m_activeScopes = 0;
+	bool m_resetPending = false;
 };
 
 /// Wrapper around handles into the YulString repository.
@@ -126,7 +187,7 @@ class YulString
 {
 public:
 	YulString() = default;
-	explicit YulString(std::string const& _s): m_handle(YulStringRepository::instance().stringToHandle(_s)) {}
+	explicit YulString(std::string_view _s): m_handle(YulStringRepository::instance().stringToHandle(_s)) {}
 	YulString(YulString const&) = default;
 	YulString(YulString&&) = default;
 	YulString& operator=(YulString const&) = default;
@@ -164,7 +225,7 @@ private:
 
 inline YulString operator "" _yulstring(char const* _string, std::size_t _size)
 {
-	return YulString(std::string(_string, _size));
+	return YulString(std::string_view(_string, _size));
 }
 
 }
@@ -35,6 +35,8 @@
 
 #include <boost/range/adaptor/reversed.hpp>
 
+#include <mutex>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
@@ -308,7 +310,9 @@ bool EVMDialect::reservedIdentifier(YulString _name) const
 EVMDialect const& EVMDialect::strictAssemblyForEVM(langutil::EVMVersion _version)
 {
 	static map<langutil::EVMVersion, unique_ptr<EVMDialect const>> dialects;
-	static YulStringRepository::ResetCallback callback{[&] { dialects.clear(); }};
+	static mutex dialectsMutex;
+	static YulStringRepository::ResetCallback callback{[&] { lock_guard<mutex> lock(dialectsMutex); dialects.clear(); }};
+	lock_guard<mutex> lock(dialectsMutex);
 	if (!dialects[_version])
 		dialects[_version] = make_unique<EVMDialect>(_version, false);
 	return *dialects[_version];
@@ -317,7 +321,9 @@ EVMDialect const& EVMDialect::strictAssemblyForEVM(langutil::EVMVersion _version
 EVMDialect const& EVMDialect::strictAssemblyForEVMObjects(langutil::EVMVersion _version)
 {
 	static map<langutil::EVMVersion, unique_ptr<EVMDialect const>> dialects;
-	static YulStringRepository::ResetCallback callback{[&] { dialects.clear(); }};
+	static mutex dialectsMutex;
+	static YulStringRepository::ResetCallback callback{[&] { lock_guard<mutex> lock(dialectsMutex); dialects.clear(); }};
+	lock_guard<mutex> lock(dialectsMutex);
 	if (!dialects[_version])
 		dialects[_version] = make_unique<EVMDialect>(_version, true);
 	return *dialects[_version];
@@ -444,7 +450,9 @@ BuiltinFunctionForEVM const* EVMDialectTyped::equalityFunction(YulString _type)
 EVMDialectTyped const& EVMDialectTyped::instance(langutil::EVMVersion _version)
 {
 	static map<langutil::EVMVersion, unique_ptr<EVMDialectTyped const>> dialects;
-	static YulStringRepository::ResetCallback callback{[&] { dialects.clear(); }};
+	static mutex dialectsMutex;
+	static YulStringRepository::ResetCallback callback{[&] { lock_guard<mutex> lock(dialectsMutex); dialects.clear(); }};
+	lock_guard<mutex> lock(dialectsMutex);
 	if (!dialects[_version])
 		dialects[_version] = make_unique<EVMDialectTyped>(_version, true);
 	return *dialects[_version];
@@ -0,0 +1,162 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Optimiser component that calculates a hash value for a complete AST.
+ */
+
+#include <libyul/optimiser/ASTHasher.h>
+
+#include <libyul/AST.h>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul;
+
+namespace
+{
+/// Distinguishes the kinds of AST nodes in the hash.
+enum class NodeKind: uint64_t
+{
+	Literal = 1,
+	Identifier,
+	FunctionCall,
+	ExpressionStatement,
+	Assignment,
+	VariableDeclaration,
+	If,
+	Switch,
+	FunctionDefinition,
+	ForLoop,
+	Break,
+	Continue,
+	Leave,
+	Block
+};
+}
+
+uint64_t ASTHasher::run(Block const& _block)
+{
+	ASTHasher hasher;
+	hasher(_block);
+	return hasher.m_hash;
+}
+
+void ASTHasher::operator()(Literal const& _literal)
+{
+	hash(static_cast<uint64_t>(NodeKind::Literal));
+	hash(static_cast<uint64_t>(_literal.kind));
+	hash(_literal.value.hash());
+	hash(_literal.type.hash());
+}
+
+void ASTHasher::operator()(Identifier const& _identifier)
+{
+	hash(static_cast<uint64_t>(NodeKind::Identifier));
+	hash(_identifier.name.hash());
+}
+
+void ASTHasher::operator()(FunctionCall const& _funCall)
+{
+	hash(static_cast<uint64_t>(NodeKind::FunctionCall));
+	hash(_funCall.functionName.name.hash());
+	hash(_funCall.arguments.size());
+	ASTWalker::operator()(_funCall);
+}
+
+void ASTHasher::operator()(ExpressionStatement const& _statement)
+{
+	hash(static_cast<uint64_t>(NodeKind::ExpressionStatement));
+	ASTWalker::operator()(_statement);
+}
+
+void ASTHasher::operator()(Assignment const& _assignment)
+{
+	hash(static_cast<uint64_t>(NodeKind::Assignment));
+	hash(_assignment.variableNames.size());
+	ASTWalker::operator()(_assignment);
+}
+
+void ASTHasher::operator()(VariableDeclaration const& _varDecl)
+{
+	hash(static_cast<uint64_t>(NodeKind::VariableDeclaration));
+	hash(_varDecl.variables);
+	hash(_varDecl.value ? 1 : 0);
+	ASTWalker::operator()(_varDecl);
+}
+
+void ASTHasher::operator()(If const& _if)
+{
+	hash(static_cast<uint64_t>(NodeKind::If));
+	ASTWalker::operator()(_if);
+}
+
+void ASTHasher::operator()(Switch const& _switch)
+{
+	hash(static_cast<uint64_t>(NodeKind::Switch));
+	hash(_switch.cases.size());
+	for (Case const& _case: _switch.cases)
+		hash(_case.value ? 1 : 0);
+	ASTWalker::operator()(_switch);
+}
+
+void ASTHasher::operator()(FunctionDefinition const& _funDef)
+{
+	hash(static_cast<uint64_t>(NodeKind::FunctionDefinition));
+	hash(_funDef.name.hash());
+	hash(_funDef.parameters);
+	hash(_funDef.returnVariables);
+	ASTWalker::operator()(_funDef);
+}
+
+void ASTHasher::operator()(ForLoop const& _loop)
+{
+	hash(static_cast<uint64_t>(NodeKind::ForLoop));
+	ASTWalker::operator()(_loop);
+}
+
+void ASTHasher::operator()(Break const&)
+{
+	hash(static_cast<uint64_t>(NodeKind::Break));
+}
+
+void ASTHasher::operator()(Continue const&)
+{
+	hash(static_cast<uint64_t>(NodeKind::Continue));
+}
+
+void ASTHasher::operator()(Leave const&)
+{
+	hash(static_cast<uint64_t>(NodeKind::Leave));
+}
+
+void ASTHasher::operator()(Block const& _block)
+{
+	hash(static_cast<uint64_t>(NodeKind::Block));
+	hash(_block.statements.size());
+	ASTWalker::operator()(_block);
+}
+
+void ASTHasher::hash(vector<TypedName> const& _names)
+{
+	hash(_names.size());
+	for (TypedName const& name: _names)
+	{
+		hash(name.name.hash());
+		hash(name.type.hash());
+	}
+}
@@ -0,0 +1,77 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Optimiser component that calculates a hash value for a complete AST.
+ */
+#pragma once
+
+#include <libyul/optimiser/ASTWalker.h>
+#include <libyul/ASTForward.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace solidity::yul
+{
+
+/**
+ * Calculates a hash value of an AST, including all names, types and literal values.
+ * Source locations are not taken into account.
+ *
+ * In contrast to the BlockHasher, renaming a variable changes the hash.
+ * This allows detecting cheaply whether an optimiser step changed the code,
+ * without keeping a copy of the AST.
+ *
+ * Prerequisite: None
+ */
+class ASTHasher: public ASTWalker
+{
+public:
+	static std::uint64_t run(Block const& _block);
+
+	using ASTWalker::operator();
+
+	void operator()(Literal const& _literal) override;
+	void operator()(Identifier const& _identifier) override;
+	void operator()(FunctionCall const& _funCall) override;
+	void operator()(ExpressionStatement const& _statement) override;
+	void operator()(Assignment const& _assignment) override;
+	void operator()(VariableDeclaration const& _varDecl) override;
+	void operator()(If const& _if) override;
+	void operator()(Switch const& _switch) override;
+	void operator()(FunctionDefinition const& _funDef) override;
+	void operator()(ForLoop const& _loop) override;
+	void operator()(Break const&) override;
+	void operator()(Continue const&) override;
+	void operator()(Leave const&) override;
+	void operator()(Block const& _block) override;
+
+private:
+	ASTHasher() = default;
+
+	void hash(std::uint64_t _value)
+	{
+		m_hash ^= _value;
+		m_hash *= 1099511628211u;
+	}
+	void hash(std::vector<TypedName> const& _names);
+
+	std::uint64_t m_hash = 14695981039346656037u;
+};
+
+}
@@ -39,7 +39,9 @@ void CommonSubexpressionEliminator::run(OptimiserStepContext& _context, Block& _
 {
 	CommonSubexpressionEliminator cse{
 		_context.dialect,
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast))
+		_context.fullAST ?
+			*_context.fullAST->functionSideEffects :
+			SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast))
 	};
 	cse(_ast);
 }
@@ -38,7 +38,7 @@ namespace
 {
 
 ExpressionStatement makeDiscardCall(
-	langutil::SourceLocation const& _location,
+	langutil::CompactSourceLocation const& _location,
 	BuiltinFunction const& _discardFunction,
 	Expression&& _expression
 )
@@ -79,8 +79,13 @@ void removeEmptyCasesFromSwitch(Switch& _switchStmt)
 
 void ControlFlowSimplifier::run(OptimiserStepContext& _context, Block& _ast)
 {
-	TypeInfo typeInfo(_context.dialect, _ast);
-	ControlFlowSimplifier{_context.dialect, typeInfo}(_ast);
+	if (_context.fullAST)
+		ControlFlowSimplifier{_context.dialect, *_context.fullAST->typeInfo}(_ast);
+	else
+	{
+		TypeInfo typeInfo(_context.dialect, _ast);
+		ControlFlowSimplifier{_context.dialect, typeInfo}(_ast);
+	}
 }
 
 void ControlFlowSimplifier::operator()(Block& _block)
@@ -40,7 +40,7 @@ using namespace solidity::langutil;
 
 void ExpressionSplitter::run(OptimiserStepContext& _context, Block& _ast)
 {
-	TypeInfo typeInfo(_context.dialect, _ast);
+	TypeInfo typeInfo = _context.fullAST ? *_context.fullAST->typeInfo : TypeInfo(_context.dialect, _ast);
 	ExpressionSplitter{_context.dialect, _context.dispenser, typeInfo}(_ast);
 }
 
@@ -101,7 +101,7 @@ void ExpressionSplitter::outlineExpression(Expression& _expr)
 
 	visit(_expr);
 
-	SourceLocation location = locationOf(_expr);
+	CompactSourceLocation location = locationOf(_expr);
 	YulString var = m_nameDispenser.newName({});
 	YulString type = m_typeInfo.typeOf(_expr);
 	m_statementsToPrefix.emplace_back(VariableDeclaration{
@@ -39,7 +39,7 @@ void ForLoopConditionIntoBody::operator()(ForLoop& _forLoop)
 		!holds_alternative<Identifier>(*_forLoop.condition)
 	)
 	{
-		langutil::SourceLocation const loc = locationOf(*_forLoop.condition);
+		langutil::CompactSourceLocation const loc = locationOf(*_forLoop.condition);
 
 		_forLoop.body.statements.emplace(
 			begin(_forLoop.body.statements),
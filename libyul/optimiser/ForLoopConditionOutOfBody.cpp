@@ -55,7 +55,7 @@ void ForLoopConditionOutOfBody::operator()(ForLoop& _forLoop)
 		return;
 
 	YulString iszero = m_dialect.booleanNegationFunction()->name;
-	langutil::SourceLocation location = locationOf(*firstStatement.condition);
+	langutil::CompactSourceLocation location = locationOf(*firstStatement.condition);
 
 	if (
 		holds_alternative<FunctionCall>(*firstStatement.condition) &&
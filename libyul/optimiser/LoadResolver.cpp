@@ -34,10 +34,14 @@ using namespace solidity::yul;
 
 void LoadResolver::run(OptimiserStepContext& _context, Block& _ast)
 {
-	bool containsMSize = MSizeFinder::containsMSize(_context.dialect, _ast);
+	bool containsMSize = _context.fullAST ?
+		*_context.fullAST->containsMSize :
+		MSizeFinder::containsMSize(_context.dialect, _ast);
 	LoadResolver{
 		_context.dialect,
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast)),
+		_context.fullAST ?
+			*_context.fullAST->functionSideEffects :
+			SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast)),
 		!containsMSize
 	}(_ast);
 }
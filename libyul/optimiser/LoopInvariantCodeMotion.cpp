@@ -33,9 +33,12 @@ using namespace solidity::yul;
 
 void LoopInvariantCodeMotion::run(OptimiserStepContext& _context, Block& _ast)
 {
-	map<YulString, SideEffects> functionSideEffects =
+	map<YulString, SideEffects> functionSideEffects = _context.fullAST ?
+		*_context.fullAST->functionSideEffects :
 		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast));
-	bool containsMSize = MSizeFinder::containsMSize(_context.dialect, _ast);
+	bool containsMSize = _context.fullAST ?
+		*_context.fullAST->containsMSize :
+		MSizeFinder::containsMSize(_context.dialect, _ast);
 	set<YulString> ssaVars = SSAValueTracker::ssaVariables(_ast);
 	LoopInvariantCodeMotion{_context.dialect, ssaVars, functionSideEffects, containsMSize}(_ast);
 }
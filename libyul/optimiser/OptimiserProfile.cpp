@@ -0,0 +1,136 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Profile of the steps executed by the optimiser suite.
+ */
+
+#include <libyul/optimiser/OptimiserProfile.h>
+
+#include <libyul/optimiser/Suite.h>
+#include <libyul/Exceptions.h>
+
+#include <map>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul;
+
+namespace
+{
+
+Json::Value microseconds(chrono::steady_clock::duration _time)
+{
+	return Json::Value(static_cast<Json::UInt64>(chrono::duration_cast<chrono::microseconds>(_time).count()));
+}
+
+Json::Value codeSizeChange(size_t _before, size_t _after)
+{
+	return Json::Value(static_cast<Json::Int64>(_after) - static_cast<Json::Int64>(_before));
+}
+
+}
+
+void OptimiserProfile::beginSegment(string _abbreviations, bool _untilStable)
+{
+	m_segments.emplace_back(Segment{move(_abbreviations), _untilStable, {}});
+}
+
+void OptimiserProfile::beginRound()
+{
+	yulAssert(!m_segments.empty(), "");
+	m_segments.back().rounds.emplace_back();
+}
+
+void OptimiserProfile::recordStep(StepRun const& _run)
+{
+	yulAssert(!m_segments.empty() && !m_segments.back().rounds.empty(), "");
+	m_segments.back().rounds.back().emplace_back(_run);
+}
+
+Json::Value OptimiserProfile::toJson() const
+{
+	struct StepTotals
+	{
+		size_t runs = 0;
+		size_t changes = 0;
+		chrono::steady_clock::duration time{};
+		Json::Int64 codeSizeChange = 0;
+	};
+	map<char, StepTotals> totals;
+	chrono::steady_clock::duration totalTime{};
+
+	Json::Value segments(Json::arrayValue);
+	for (Segment const& segment: m_segments)
+	{
+		Json::Value segmentJson(Json::objectValue);
+		segmentJson["steps"] = segment.abbreviations;
+		segmentJson["untilStable"] = segment.untilStable;
+		segmentJson["rounds"] = Json::arrayValue;
+		for (vector<StepRun> const& round: segment.rounds)
+		{
+			Json::Value roundJson(Json::objectValue);
+			chrono::steady_clock::duration roundTime{};
+			bool roundChanged = false;
+			roundJson["steps"] = Json::arrayValue;
+			for (StepRun const& run: round)
+			{
+				Json::Value runJson(Json::objectValue);
+				runJson["step"] = string(1, run.abbreviation);
+				runJson["time"] = microseconds(run.time);
+				runJson["codeSizeChange"] = codeSizeChange(run.codeSizeBefore, run.codeSizeAfter);
+				runJson["changed"] = run.changed;
+				roundJson["steps"].append(move(runJson));
+
+				StepTotals& stepTotals = totals[run.abbreviation];
+				++stepTotals.runs;
+				if (run.changed)
+					++stepTotals.changes;
+				stepTotals.time += run.time;
+				stepTotals.codeSizeChange += codeSizeChange(run.codeSizeBefore, run.codeSizeAfter).asInt64();
+
+				roundTime += run.time;
+				roundChanged = roundChanged || run.changed;
+			}
+			roundJson["time"] = microseconds(roundTime);
+			roundJson["codeSizeBefore"] = round.empty() ? 0 : Json::UInt64(round.front().codeSizeBefore);
+			roundJson["codeSizeAfter"] = round.empty() ? 0 : Json::UInt64(round.back().codeSizeAfter);
+			roundJson["changed"] = roundChanged;
+			segmentJson["rounds"].append(move(roundJson));
+			totalTime += roundTime;
+		}
+		segments.append(move(segmentJson));
+	}
+
+	Json::Value steps(Json::objectValue);
+	for (auto const& [abbreviation, stepTotals]: totals)
+	{
+		Json::Value stepJson(Json::objectValue);
+		stepJson["name"] = OptimiserSuite::stepAbbreviationToNameMap().at(abbreviation);
+		stepJson["runs"] = Json::UInt64(stepTotals.runs);
+		stepJson["changes"] = Json::UInt64(stepTotals.changes);
+		stepJson["time"] = microseconds(stepTotals.time);
+		stepJson["codeSizeChange"] = stepTotals.codeSizeChange;
+		steps[string(1, abbreviation)] = move(stepJson);
+	}
+
+	Json::Value result(Json::objectValue);
+	result["time"] = microseconds(totalTime);
+	result["steps"] = move(steps);
+	result["sequence"] = move(segments);
+	return result;
+}
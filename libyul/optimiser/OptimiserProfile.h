@@ -0,0 +1,71 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Profile of the steps executed by the optimiser suite.
+ */
+
+#pragma once
+
+#include <json/json.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace solidity::yul
+{
+
+/**
+ * Records the run time and the effect of every optimiser step executed by the OptimiserSuite,
+ * grouped by the segments of the step sequence and the rounds of `[...]` segments.
+ */
+class OptimiserProfile
+{
+public:
+	struct StepRun
+	{
+		char abbreviation = 0;
+		std::chrono::steady_clock::duration time{};
+		size_t codeSizeBefore = 0;
+		size_t codeSizeAfter = 0;
+		/// True if the step modified the AST (based on an AST hash).
+		bool changed = false;
+	};
+
+	/// Starts a new segment of the sequence, given by its step abbreviations.
+	/// @param _untilStable true for a `[...]` segment that is repeated until the code is stable.
+	void beginSegment(std::string _abbreviations, bool _untilStable);
+	/// Starts a new round of the current segment.
+	void beginRound();
+	void recordStep(StepRun const& _run);
+
+	/// @returns the profile in JSON format. Times are given in microseconds.
+	Json::Value toJson() const;
+
+private:
+	struct Segment
+	{
+		std::string abbreviations;
+		bool untilStable = false;
+		std::vector<std::vector<StepRun>> rounds;
+	};
+
+	std::vector<Segment> m_segments;
+};
+
+}
@@ -19,7 +19,11 @@
 #pragma once
 
 #include <libyul/Exceptions.h>
+#include <libyul/SideEffects.h>
+#include <libyul/YulString.h>
+#include <libyul/optimiser/TypeInfo.h>
 
+#include <map>
 #include <optional>
 #include <string>
 #include <set>
@@ -29,14 +33,30 @@ namespace solidity::yul
 
 struct Dialect;
 struct Block;
-class YulString;
 class NameDispenser;
 
+/**
+ * Information about a full AST that steps need if they are only applied to a part of it,
+ * e.g. to some of its functions. Only the information used by the step is provided.
+ */
+struct FullASTInformation
+{
+	/// Side effects of all functions of the AST.
+	std::optional<std::map<YulString, SideEffects>> functionSideEffects;
+	/// Whether the AST contains the msize instruction.
+	std::optional<bool> containsMSize;
+	/// Types of all variables and functions of the AST.
+	std::optional<TypeInfo> typeInfo;
+};
+
 struct OptimiserStepContext
 {
 	Dialect const& dialect;
 	NameDispenser& dispenser;
 	std::set<YulString> const& reservedIdentifiers;
+	/// Information about the full AST if the step is only applied to a part of it.
+	/// If null, the step is applied to the full AST.
+	FullASTInformation const* fullAST = nullptr;
 };
 
 
@@ -389,7 +389,7 @@ void PropagateValues::operator()(Block& _block)
 
 void SSATransform::run(OptimiserStepContext& _context, Block& _ast)
 {
-	TypeInfo typeInfo(_context.dialect, _ast);
+	TypeInfo typeInfo = _context.fullAST ? *_context.fullAST->typeInfo : TypeInfo(_context.dialect, _ast);
 	Assignments assignments;
 	assignments(_ast);
 	IntroduceSSA{_context.dispenser, assignments.names(), typeInfo}(_ast);
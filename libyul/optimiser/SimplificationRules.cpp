@@ -47,7 +47,8 @@ SimplificationRules::Rule const* SimplificationRules::findFirstMatch(
 	if (!instruction)
 		return nullptr;
 
-	static std::map<std::optional<EVMVersion>, std::unique_ptr<SimplificationRules>> evmRules;
+	// The rules store the state of the current match, so every thread needs its own copy.
+	thread_local std::map<std::optional<EVMVersion>, std::unique_ptr<SimplificationRules>> evmRules;
 
 	std::optional<EVMVersion> version;
 	if (yul::EVMDialect const* evmDialect = dynamic_cast<yul::EVMDialect const*>(&_dialect))
@@ -234,7 +235,7 @@ evmasm::Instruction Pattern::instruction() const
 	return m_instruction;
 }
 
-Expression Pattern::toExpression(SourceLocation const& _location) const
+Expression Pattern::toExpression(CompactSourceLocation const& _location) const
 {
 	if (matchGroup())
 		return ASTCopier().translate(matchGroupValue());
@@ -24,12 +24,12 @@
 #include <libevmasm/SimplificationRule.h>
 
 #include <libyul/ASTForward.h>
+#include <liblangutil/CompactSourceLocation.h>
 #include <libyul/YulString.h>
 
 #include <libsolutil/CommonData.h>
 
 #include <liblangutil/EVMVersion.h>
-#include <liblangutil/SourceLocation.h>
 
 #include <boost/noncopyable.hpp>
 
@@ -128,7 +128,7 @@ public:
 
 	/// Turns this pattern into an actual expression. Should only be called
 	/// for patterns resulting from an action, i.e. with match groups assigned.
-	Expression toExpression(langutil::SourceLocation const& _location) const;
+	Expression toExpression(langutil::CompactSourceLocation const& _location) const;
 
 private:
 	Expression const& matchGroupValue() const;
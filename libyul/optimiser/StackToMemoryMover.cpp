@@ -31,7 +31,7 @@ namespace
 {
 vector<Statement> generateMemoryStore(
 	Dialect const& _dialect,
-	langutil::SourceLocation const& _loc,
+	langutil::CompactSourceLocation const& _loc,
 	YulString _mpos,
 	Expression _value
 )
@@ -50,7 +50,7 @@ vector<Statement> generateMemoryStore(
 	return result;
 }
 
-FunctionCall generateMemoryLoad(Dialect const& _dialect, langutil::SourceLocation const& _loc, YulString _mpos)
+FunctionCall generateMemoryLoad(Dialect const& _dialect, langutil::CompactSourceLocation const& _loc, YulString _mpos)
 {
 	BuiltinFunction const* memoryLoadFunction = _dialect.memoryLoadFunction(_dialect.defaultType);
 	yulAssert(memoryLoadFunction, "");
@@ -123,7 +123,7 @@ void StackToMemoryMover::operator()(Block& _block)
 		if (!leftHandSideNeedsMoving)
 			return {};
 
-		langutil::SourceLocation loc = _stmt.location;
+		langutil::CompactSourceLocation loc = _stmt.location;
 
 		if (_variables.size() == 1)
 		{
@@ -60,6 +60,8 @@
 #include <libyul/optimiser/LoopInvariantCodeMotion.h>
 #include <libyul/optimiser/Metrics.h>
 #include <libyul/optimiser/NameSimplifier.h>
+#include <libyul/optimiser/OptimiserProfile.h>
+#include <libyul/optimiser/ASTHasher.h>
 #include <libyul/backends/evm/ConstantOptimiser.h>
 #include <libyul/AsmAnalysis.h>
 #include <libyul/AsmAnalysisInfo.h>
@@ -71,11 +73,15 @@
 #include <libyul/backends/evm/NoOutputAssembly.h>
 
 #include <libsolutil/CommonData.h>
+#include <libsolutil/Parallel.h>
 
 #include <boost/range/adaptor/map.hpp>
 #include <boost/range/algorithm_ext/erase.hpp>
 #include <libyul/CompilabilityChecker.h>
 
+#include <chrono>
+#include <optional>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
@@ -86,7 +92,9 @@ void OptimiserSuite::run(
 	Object& _object,
 	bool _optimizeStackAllocation,
 	string const& _optimisationSequence,
-	set<YulString> const& _externallyUsedIdentifiers
+	set<YulString> const& _externallyUsedIdentifiers,
+	OptimiserProfile* _profile,
+	size_t _parallelism
 )
 {
 	set<YulString> reservedIdentifiers = _externallyUsedIdentifiers;
@@ -99,7 +107,14 @@ void OptimiserSuite::run(
 	)(*_object.code));
 	Block& ast = *_object.code;
 
-	OptimiserSuite suite(_dialect, reservedIdentifiers, Debug::None, ast);
+	OptimiserSuite suite(
+		_dialect,
+		reservedIdentifiers,
+		Debug::None,
+		ast,
+		_profile,
+		_parallelism
+	);
 
 	// Some steps depend on properties ensured by FunctionHoister, BlockFlattener, FunctionGrouper and
 	// ForLoopInitRewriter. Run them first to be able to run arbitrary sequences safely.
@@ -152,6 +167,64 @@ void OptimiserSuite::run(
 namespace
 {
 
+/// Properties of a step whose effect on a function only depends on the function itself and
+/// on the information about the full AST given by FullASTInformation. Such a step can be
+/// applied to the main code and to each function separately.
+struct FunctionLocalStep
+{
+	/// The step creates new names. The main block and the functions are then processed by a
+	/// single run of the step, so that the names do not depend on the number of threads.
+	bool usesDispenser = false;
+	/// The step uses the side effects of the called functions and whether the AST contains msize.
+	bool usesSideEffects = false;
+	/// The step uses the types of the called functions.
+	bool usesTypes = false;
+};
+
+/// @returns the properties of @a _step if it is function-local and nullptr otherwise.
+FunctionLocalStep const* functionLocalStep(string const& _step)
+{
+	static map<string, FunctionLocalStep> const functionLocalSteps{
+		{CommonSubexpressionEliminator::name, {false, true, false}},
+		{ConditionalSimplifier::name, {}},
+		{ConditionalUnsimplifier::name, {}},
+		{ControlFlowSimplifier::name, {false, false, true}},
+		{DeadCodeEliminator::name, {}},
+		{ExpressionJoiner::name, {}},
+		{ExpressionSimplifier::name, {}},
+		{ExpressionSplitter::name, {true, false, true}},
+		{ForLoopConditionIntoBody::name, {}},
+		{ForLoopConditionOutOfBody::name, {}},
+		{ForLoopInitRewriter::name, {}},
+		{LiteralRematerialiser::name, {}},
+		{LoadResolver::name, {false, true, false}},
+		{LoopInvariantCodeMotion::name, {false, true, false}},
+		{RedundantAssignEliminator::name, {}},
+		{Rematerialiser::name, {}},
+		{SSAReverser::name, {}},
+		{SSATransform::name, {true, false, true}},
+		{StructuralSimplifier::name, {}},
+		{VarDeclInitializer::name, {}}
+	};
+	auto it = functionLocalSteps.find(_step);
+	return it == functionLocalSteps.end() ? nullptr : &it->second;
+}
+
+/// @returns the number of statements before the function definitions of @a _ast, if all
+/// function definitions follow the other statements, as after FunctionGrouper (one block)
+/// or BlockFlattener, and nullopt otherwise or if there are no function definitions.
+optional<size_t> mainCodeLength(Block const& _ast)
+{
+	auto firstFunction = find_if(_ast.statements.begin(), _ast.statements.end(), [](Statement const& _statement) {
+		return holds_alternative<FunctionDefinition>(_statement);
+	});
+	if (firstFunction == _ast.statements.end())
+		return nullopt;
+	for (auto it = firstFunction; it != _ast.statements.end(); ++it)
+		if (!holds_alternative<FunctionDefinition>(*it))
+			return nullopt;
+	return static_cast<size_t>(firstFunction - _ast.statements.begin());
+}
 
 template <class... Step>
 map<string, unique_ptr<OptimiserStep>> optimiserStepCollection()
@@ -171,40 +244,38 @@ map<string, unique_ptr<OptimiserStep>> optimiserStepCollection()
 
 map<string, unique_ptr<OptimiserStep>> const& OptimiserSuite::allSteps()
 {
-	static map<string, unique_ptr<OptimiserStep>> instance;
-	if (instance.empty())
-		instance = optimiserStepCollection<
-			BlockFlattener,
-			CircularReferencesPruner,
-			CommonSubexpressionEliminator,
-			ConditionalSimplifier,
-			ConditionalUnsimplifier,
-			ControlFlowSimplifier,
-			DeadCodeEliminator,
-			EquivalentFunctionCombiner,
-			ExpressionInliner,
-			ExpressionJoiner,
-			ExpressionSimplifier,
-			ExpressionSplitter,
-			ForLoopConditionIntoBody,
-			ForLoopConditionOutOfBody,
-			ForLoopInitRewriter,
-			FullInliner,
-			FunctionGrouper,
-			FunctionHoister,
-			LiteralRematerialiser,
-			LoadResolver,
-			LoopInvariantCodeMotion,
-			RedundantAssignEliminator,
-			ReasoningBasedSimplifier,
-			Rematerialiser,
-			SSAReverser,
-			SSATransform,
-			StructuralSimplifier,
-			UnusedFunctionParameterPruner,
-			UnusedPruner,
-			VarDeclInitializer
-		>();
+	static map<string, unique_ptr<OptimiserStep>> const instance = optimiserStepCollection<
+		BlockFlattener,
+		CircularReferencesPruner,
+		CommonSubexpressionEliminator,
+		ConditionalSimplifier,
+		ConditionalUnsimplifier,
+		ControlFlowSimplifier,
+		DeadCodeEliminator,
+		EquivalentFunctionCombiner,
+		ExpressionInliner,
+		ExpressionJoiner,
+		ExpressionSimplifier,
+		ExpressionSplitter,
+		ForLoopConditionIntoBody,
+		ForLoopConditionOutOfBody,
+		ForLoopInitRewriter,
+		FullInliner,
+		FunctionGrouper,
+		FunctionHoister,
+		LiteralRematerialiser,
+		LoadResolver,
+		LoopInvariantCodeMotion,
+		RedundantAssignEliminator,
+		ReasoningBasedSimplifier,
+		Rematerialiser,
+		SSAReverser,
+		SSATransform,
+		StructuralSimplifier,
+		UnusedFunctionParameterPruner,
+		UnusedPruner,
+		VarDeclInitializer
+	>();
 	// Does not include VarNameCleaner because it destroys the property of unique names.
 	// Does not include NameSimplifier.
 	return instance;
@@ -338,6 +409,18 @@ void OptimiserSuite::runSequence(string const& _stepAbbreviations, Block& _ast)
 
 void OptimiserSuite::runSequence(std::vector<string> const& _steps, Block& _ast)
 {
+	if (_steps.empty())
+		return;
+
+	beginProfileSegment(_steps, false);
+	runSteps(_steps, _ast);
+}
+
+void OptimiserSuite::runSteps(std::vector<string> const& _steps, Block& _ast)
+{
+	if (m_profile)
+		m_profile->beginRound();
+
 	unique_ptr<Block> copy;
 	if (m_debug == Debug::PrintChanges)
 		copy = make_unique<Block>(std::get<Block>(ASTCopier{}(_ast)));
@@ -345,7 +428,21 @@ void OptimiserSuite::runSequence(std::vector<string> const& _steps, Block& _ast)
 	{
 		if (m_debug == Debug::PrintStep)
 			cout << "Running " << step << endl;
-		allSteps().at(step)->run(m_context, _ast);
+		if (m_profile)
+		{
+			OptimiserProfile::StepRun run;
+			run.abbreviation = stepNameToAbbreviationMap().at(step);
+			run.codeSizeBefore = CodeSize::codeSizeIncludingFunctions(_ast);
+			uint64_t hashBefore = ASTHasher::run(_ast);
+			auto start = chrono::steady_clock::now();
+			runStep(step, _ast);
+			run.time = chrono::steady_clock::now() - start;
+			run.codeSizeAfter = CodeSize::codeSizeIncludingFunctions(_ast);
+			run.changed = ASTHasher::run(_ast) != hashBefore;
+			m_profile->recordStep(run);
+		}
+		else
+			runStep(step, _ast);
 		if (m_debug == Debug::PrintChanges)
 		{
 			// TODO should add switch to also compare variable names!
@@ -361,6 +458,79 @@ void OptimiserSuite::runSequence(std::vector<string> const& _steps, Block& _ast)
 	}
 }
 
+void OptimiserSuite::runStep(string const& _step, Block& _ast)
+{
+	OptimiserStep const& step = *allSteps().at(_step);
+	FunctionLocalStep const* localStep = functionLocalStep(_step);
+	optional<size_t> mainLength = localStep ? mainCodeLength(_ast) : nullopt;
+	if (!mainLength)
+	{
+		step.run(m_context, _ast);
+		return;
+	}
+
+	FullASTInformation fullAST;
+	if (localStep->usesSideEffects)
+	{
+		fullAST.functionSideEffects =
+			SideEffectsPropagator::sideEffects(m_context.dialect, CallGraphGenerator::callGraph(_ast));
+		fullAST.containsMSize = MSizeFinder::containsMSize(m_context.dialect, _ast);
+	}
+	if (localStep->usesTypes)
+		fullAST.typeInfo.emplace(m_context.dialect, _ast);
+
+	// The main code and the functions are moved into separate ASTs of the form { I... }
+	// and { F }, so that they can be processed concurrently, or into a single AST
+	// { I... F... }. The main code I... is a single block if the AST is grouped.
+	size_t const functionCount = _ast.statements.size() - *mainLength;
+	bool const concurrent = m_parallelism > 1 && !localStep->usesDispenser && functionCount > 0;
+	vector<Block> units;
+	units.emplace_back(Block{_ast.location, {}});
+	for (size_t i = 0; i < *mainLength; ++i)
+		units.front().statements.emplace_back(std::move(_ast.statements[i]));
+	for (size_t i = *mainLength; i < _ast.statements.size(); ++i)
+	{
+		if (concurrent)
+			units.emplace_back(Block{_ast.location, {}});
+		units.back().statements.emplace_back(std::move(_ast.statements[i]));
+	}
+
+	OptimiserStepContext context{m_context.dialect, m_context.dispenser, m_context.reservedIdentifiers, &fullAST};
+	vector<exception_ptr> exceptions = util::parallelFor(units.size(), concurrent ? m_parallelism : 1, [&](size_t _index) {
+		step.run(context, units[_index]);
+	});
+	for (exception_ptr const& exception: exceptions)
+		if (exception)
+			rethrow_exception(exception);
+
+	// The step can change the number of statements of the main code, but does not move
+	// statements across function definitions.
+	vector<Statement>& mainUnit = units.front().statements;
+	yulAssert(mainUnit.size() >= (concurrent ? 0 : functionCount), "");
+	size_t const newMainLength = mainUnit.size() - (concurrent ? 0 : functionCount);
+	for (size_t i = 0; i < mainUnit.size(); ++i)
+		yulAssert(holds_alternative<FunctionDefinition>(mainUnit[i]) == (i >= newMainLength), "");
+	for (size_t i = 0; i < functionCount; ++i)
+	{
+		if (concurrent)
+			yulAssert(units[i + 1].statements.size() == 1, "");
+		Statement& statement = concurrent ? units[i + 1].statements.back() : mainUnit[newMainLength + i];
+		size_t const position = *mainLength + i;
+		yulAssert(
+			std::get<FunctionDefinition>(statement).name == std::get<FunctionDefinition>(_ast.statements[position]).name,
+			""
+		);
+		_ast.statements[position] = std::move(statement);
+	}
+	mainUnit.resize(newMainLength);
+	_ast.statements.erase(_ast.statements.begin(), _ast.statements.begin() + static_cast<ptrdiff_t>(*mainLength));
+	_ast.statements.insert(
+		_ast.statements.begin(),
+		make_move_iterator(mainUnit.begin()),
+		make_move_iterator(mainUnit.end())
+	);
+}
+
 void OptimiserSuite::runSequenceUntilStable(
 	std::vector<string> const& _steps,
 	Block& _ast,
@@ -370,6 +540,7 @@ void OptimiserSuite::runSequenceUntilStable(
 	if (_steps.empty())
 		return;
 
+	beginProfileSegment(_steps, true);
 	size_t codeSize = 0;
 	for (size_t rounds = 0; rounds < maxRounds; ++rounds)
 	{
@@ -378,6 +549,17 @@ void OptimiserSuite::runSequenceUntilStable(
 			break;
 		codeSize = newSize;
 
-		runSequence(_steps, _ast);
+		runSteps(_steps, _ast);
 	}
 }
+
+void OptimiserSuite::beginProfileSegment(vector<string> const& _steps, bool _untilStable)
+{
+	if (!m_profile)
+		return;
+
+	string abbreviations;
+	for (string const& step: _steps)
+		abbreviations += stepNameToAbbreviationMap().at(step);
+	m_profile->beginSegment(move(abbreviations), _untilStable);
+}
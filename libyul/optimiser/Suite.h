@@ -38,6 +38,7 @@ struct AsmAnalysisInfo;
 struct Dialect;
 class GasMeter;
 struct Object;
+class OptimiserProfile;
 
 /**
  * Optimiser suite that combines all steps and also provides the settings for the heuristics.
@@ -58,13 +59,18 @@ public:
 		PrintStep,
 		PrintChanges
 	};
+	/// @param _profile if not null, the time and effect of every step is recorded there.
+	/// @param _parallelism maximum number of threads used to apply function-local steps
+	/// to different functions concurrently. The result does not depend on this setting.
 	static void run(
 		Dialect const& _dialect,
 		GasMeter const* _meter,
 		Object& _object,
 		bool _optimizeStackAllocation,
 		std::string const& _optimisationSequence,
-		std::set<YulString> const& _externallyUsedIdentifiers = {}
+		std::set<YulString> const& _externallyUsedIdentifiers = {},
+		OptimiserProfile* _profile = nullptr,
+		size_t _parallelism = 1
 	);
 
 	/// Ensures that specified sequence of step abbreviations is well-formed and can be executed.
@@ -88,16 +94,30 @@ private:
 		Dialect const& _dialect,
 		std::set<YulString> const& _externallyUsedIdentifiers,
 		Debug _debug,
-		Block& _ast
+		Block& _ast,
+		OptimiserProfile* _profile = nullptr,
+		size_t _parallelism = 1
 	):
 		m_dispenser{_dialect, _ast, _externallyUsedIdentifiers},
 		m_context{_dialect, m_dispenser, _externallyUsedIdentifiers},
-		m_debug(_debug)
+		m_debug(_debug),
+		m_profile(_profile),
+		m_parallelism(_parallelism)
 	{}
 
+	/// Runs the given steps once, as part of the current segment and round of the profile.
+	void runSteps(std::vector<std::string> const& _steps, Block& _ast);
+	/// Runs a single step. Unless it creates new names, a function-local step is applied to
+	/// the main block and to the functions concurrently using up to m_parallelism threads.
+	void runStep(std::string const& _step, Block& _ast);
+	/// Starts a new segment in the profile, if profiling is enabled.
+	void beginProfileSegment(std::vector<std::string> const& _steps, bool _untilStable);
+
 	NameDispenser m_dispenser;
 	OptimiserStepContext m_context;
 	Debug m_debug;
+	OptimiserProfile* m_profile = nullptr;
+	size_t m_parallelism = 1;
 };
 
 }
@@ -18,10 +18,9 @@
 
 #include <libyul/optimiser/UnusedFunctionsCommon.h>
 
+#include <liblangutil/CompactSourceLocation.h>
 #include <libyul/Dialect.h>
 
-#include <liblangutil/SourceLocation.h>
-
 #include <libsolutil/CommonData.h>
 
 using namespace solidity;
@@ -46,7 +45,7 @@ FunctionDefinition unusedFunctionsCommon::createLinkingFunction(
 		};
 	};
 
-	langutil::SourceLocation loc = _original.location;
+	langutil::CompactSourceLocation loc = _original.location;
 
 	FunctionDefinition linkingFunction{
 		loc,
@@ -47,7 +47,7 @@ void VarDeclInitializer::operator()(Block& _block)
 			else
 			{
 				OptionalStatements ret{vector<Statement>{}};
-				langutil::SourceLocation loc{std::move(_varDecl.location)};
+				langutil::CompactSourceLocation loc = _varDecl.location;
 				for (auto& var: _varDecl.variables)
 				{
 					unique_ptr<Expression> expr = make_unique<Expression >(m_dialect.zeroLiteralForType(var.type));
@@ -124,6 +124,7 @@ static string const g_strAstJson = "ast-json";
 static string const g_strAstCompactJson = "ast-compact-json";
 static string const g_strBinary = "bin";
 static string const g_strBinaryRuntime = "bin-runtime";
+static string const g_strCacheDir = "cache-dir";
 static string const g_strCombinedJson = "combined-json";
 static string const g_strCompactJSON = "compact-format";
 static string const g_strContracts = "contracts";
@@ -140,6 +141,7 @@ static string const g_strHelp = "help";
 static string const g_strImportAst = "import-ast";
 static string const g_strInputFile = "input-file";
 static string const g_strInterface = "interface";
+static string const g_strJobs = "jobs";
 static string const g_strYul = "yul";
 static string const g_strYulDialect = "yul-dialect";
 static string const g_strIR = "ir";
@@ -153,6 +155,7 @@ static string const g_strMetadata = "metadata";
 static string const g_strMetadataHash = "metadata-hash";
 static string const g_strMetadataLiteral = "metadata-literal";
 static string const g_strModelCheckerEngine = "model-checker-engine";
+static string const g_strModelCheckerSolverStrategy = "model-checker-solver-strategy";
 static string const g_strModelCheckerTargets = "model-checker-targets";
 static string const g_strModelCheckerTimeout = "model-checker-timeout";
 static string const g_strNatspecDev = "devdoc";
@@ -164,11 +167,13 @@ static string const g_strOptimize = "optimize";
 static string const g_strOptimizeRuns = "optimize-runs";
 static string const g_strOptimizeYul = "optimize-yul";
 static string const g_strYulOptimizations = "yul-optimizations";
+static string const g_strYulOptimizerProfile = "yul-optimizer-profile";
 static string const g_strOutputDir = "output-dir";
 static string const g_strOverwrite = "overwrite";
 static string const g_strRevertStrings = "revert-strings";
 static string const g_strStorageLayout = "storage-layout";
 static string const g_strStopAfter = "stop-after";
+static string const g_strTimeReport = "time-report";
 static string const g_strParsing = "parsing";
 
 /// Possible arguments to for --revert-strings
@@ -206,6 +211,7 @@ static string const g_argAstCompactJson = g_strAstCompactJson;
 static string const g_argAstJson = g_strAstJson;
 static string const g_argBinary = g_strBinary;
 static string const g_argBinaryRuntime = g_strBinaryRuntime;
+static string const g_argCacheDir = g_strCacheDir;
 static string const g_argCombinedJson = g_strCombinedJson;
 static string const g_argCompactJSON = g_strCompactJSON;
 static string const g_argErrorRecovery = g_strErrorRecovery;
@@ -216,8 +222,11 @@ static string const g_argInputFile = g_strInputFile;
 static string const g_argYul = g_strYul;
 static string const g_argIR = g_strIR;
 static string const g_argIROptimized = g_strIROptimized;
+static string const g_argYulOptimizerProfile = g_strYulOptimizerProfile;
+static string const g_argTimeReport = g_strTimeReport;
 static string const g_argEwasm = g_strEwasm;
 static string const g_argExperimentalViaIR = g_strExperimentalViaIR;
+static string const g_argJobs = g_strJobs;
 static string const g_argLibraries = g_strLibraries;
 static string const g_argLink = g_strLink;
 static string const g_argMachine = g_strMachine;
@@ -225,6 +234,7 @@ static string const g_argMetadata = g_strMetadata;
 static string const g_argMetadataHash = g_strMetadataHash;
 static string const g_argMetadataLiteral = g_strMetadataLiteral;
 static string const g_argModelCheckerEngine = g_strModelCheckerEngine;
+static string const g_argModelCheckerSolverStrategy = g_strModelCheckerSolverStrategy;
 static string const g_argModelCheckerTargets = g_strModelCheckerTargets;
 static string const g_argModelCheckerTimeout = g_strModelCheckerTimeout;
 static string const g_argNatspecDev = g_strNatspecDev;
@@ -347,6 +357,24 @@ bool checkMutuallyExclusive(boost::program_options::variables_map const& args, s
 	return true;
 }
 
+/// @returns the contents of @a _file as a character stream named @a _name. The file is mapped
+/// into memory if possible, so that the stream and the compiler share its contents.
+CharStream mapSourceFile(boost::filesystem::path const& _file, string _name)
+{
+	auto file = make_shared<MappedFile const>(_file.string());
+	string_view contents = file->contents();
+	return CharStream(contents, move(file), move(_name));
+}
+
+/// @returns the contents of @a _sources as strings.
+StringMap sourceStrings(map<string, CharStream> const& _sources)
+{
+	StringMap result;
+	for (auto const& [name, source]: _sources)
+		result[name] = string(source.source());
+	return result;
+}
+
 }
 
 void CommandLineInterface::handleBinary(string const& _contract)
@@ -413,6 +441,30 @@ void CommandLineInterface::handleIROptimized(string const& _contractName)
 	}
 }
 
+void CommandLineInterface::handleYulOptimizerProfile(string const& _contractName)
+{
+	if (!m_args.count(g_argYulOptimizerProfile))
+		return;
+
+	string data = jsonCompactPrint(m_compiler->yulOptimiserProfile(_contractName));
+	if (m_args.count(g_argOutputDir))
+		createFile(m_compiler->filesystemFriendlyName(_contractName) + "_yul_optimizer_profile.json", data);
+	else
+		sout() << "Yul optimizer profile:" << endl << data << endl;
+}
+
+void CommandLineInterface::handleTimeReport()
+{
+	if (!m_args.count(g_argTimeReport))
+		return;
+
+	string data = jsonCompactPrint(m_compiler->timeReport());
+	if (m_args.count(g_argOutputDir))
+		createFile("time_report.json", data);
+	else
+		sout() << "Time report:" << endl << data << endl;
+}
+
 void CommandLineInterface::handleEwasm(string const& _contractName)
 {
 	if (!m_args.count(g_argEwasm))
@@ -627,13 +679,13 @@ bool CommandLineInterface::readInputFilesAndConfigureRemappings()
 				}
 
 				// NOTE: we ignore the FileNotFound exception as we manually check above
-				m_sourceCodes[infile.generic_string()] = readFileAsString(infile.string());
+				m_sourceCodes[infile.generic_string()] = mapSourceFile(infile, infile.generic_string());
 				path = boost::filesystem::canonical(infile).string();
 			}
 			m_allowedDirectories.push_back(boost::filesystem::path(path).remove_filename());
 		}
 	if (addStdin)
-		m_sourceCodes[g_stdinFileName] = readStandardInput();
+		m_sourceCodes[g_stdinFileName] = CharStream(readStandardInput(), g_stdinFileName);
 	if (m_sourceCodes.size() == 0)
 	{
 		serr() << "No input files given. If you wish to use the standard input please specify \"-\" explicitly." << endl;
@@ -741,12 +793,12 @@ bool CommandLineInterface::parseLibraryOption(string const& _input)
 map<string, Json::Value> CommandLineInterface::parseAstFromInput()
 {
 	map<string, Json::Value> sourceJsons;
-	map<string, string> tmpSources;
+	map<string, CharStream> tmpSources;
 
 	for (auto const& srcPair: m_sourceCodes)
 	{
 		Json::Value ast;
-		astAssert(jsonParseStrict(srcPair.second, ast), "Input file could not be parsed to JSON");
+		astAssert(jsonParseStrict(string(srcPair.second.source()), ast), "Input file could not be parsed to JSON");
 		astAssert(ast.isMember("sources"), "Invalid Format for import-JSON: Must have 'sources'-object");
 
 		for (auto& src: ast["sources"].getMemberNames())
@@ -757,7 +809,7 @@ map<string, Json::Value> CommandLineInterface::parseAstFromInput()
 			astAssert(ast["sources"][src][astKey]["nodeType"].asString() == "SourceUnit",  "Top-level node should be a 'SourceUnit'");
 			astAssert(sourceJsons.count(src) == 0, "All sources must have unique names");
 			sourceJsons.emplace(src, move(ast["sources"][src][astKey]));
-			tmpSources[src] = util::jsonCompactPrint(ast);
+			tmpSources[src] = CharStream(util::jsonCompactPrint(ast), src);
 		}
 	}
 
@@ -872,6 +924,20 @@ General Information)").c_str(),
 			g_strExperimentalViaIR.c_str(),
 			"Turn on experimental compilation mode via the IR (EXPERIMENTAL)."
 		)
+		(
+			g_strJobs.c_str(),
+			po::value<unsigned>()->value_name("n"),
+			"Number of threads used to analyze different source units, to generate bytecode "
+			"for contracts that do not create each other, to optimize the IR, and to optimize "
+			"independent sub-assemblies. The output does not depend on this setting."
+		)
+		(
+			g_strCacheDir.c_str(),
+			po::value<string>()->value_name("path"),
+			"Directory used to cache the optimized IR and the generated code across compiler runs. "
+			"Contracts that were already compiled from the same sources with the same settings "
+			"are not compiled again."
+		)
 		(
 			g_strRevertStrings.c_str(),
 			po::value<string>()->value_name(boost::join(g_revertStringsArgs, ",")),
@@ -984,12 +1050,22 @@ General Information)").c_str(),
 		(g_argAbi.c_str(), "ABI specification of the contracts.")
 		(g_argIR.c_str(), "Intermediate Representation (IR) of all contracts (EXPERIMENTAL).")
 		(g_argIROptimized.c_str(), "Optimized intermediate Representation (IR) of all contracts (EXPERIMENTAL).")
+		(
+			g_argYulOptimizerProfile.c_str(),
+			"Run time, code size change and effect of every Yul optimizer step applied to the IR of "
+			"all contracts in JSON format (EXPERIMENTAL)."
+		)
 		(g_argEwasm.c_str(), "Ewasm text representation of all contracts (EXPERIMENTAL).")
 		(g_argSignatureHashes.c_str(), "Function signature hashes of the contracts.")
 		(g_argNatspecUser.c_str(), "Natspec user documentation of all contracts.")
 		(g_argNatspecDev.c_str(), "Natspec developer documentation of all contracts.")
 		(g_argMetadata.c_str(), "Combined Metadata JSON whose Swarm hash is stored on-chain.")
 		(g_argStorageLayout.c_str(), "Slots, offsets and types of the contract's state variables.")
+		(
+			g_argTimeReport.c_str(),
+			"Time spent in the phases of the compilation, in the analysers and in the code generation "
+			"steps of every contract in JSON format. All times are given in microseconds."
+		)
 	;
 	desc.add(outputComponents);
 
@@ -1056,6 +1132,13 @@ General Information)").c_str(),
 			po::value<string>()->value_name("all,bmc,chc,none")->default_value("all"),
 			"Select model checker engine."
 		)
+		(
+			g_strModelCheckerSolverStrategy.c_str(),
+			po::value<string>()->value_name("crossCheck,race")->default_value("crossCheck"),
+			"Select how the answers of multiple SMT solvers are combined. "
+			"crossCheck queries the solvers one after another and reports conflicting answers, "
+			"race queries them concurrently and uses the first answer."
+		)
 		(
 			g_strModelCheckerTargets.c_str(),
 			po::value<string>()->value_name("all,constantCondition,underflow,overflow,divByZero,balance,assert,popEmptyArray")->default_value("all"),
@@ -1101,6 +1184,7 @@ General Information)").c_str(),
 		g_argBinary,
 		g_argIR,
 		g_argIROptimized,
+		g_argYulOptimizerProfile,
 		g_argEwasm,
 		g_argGas,
 		g_argAsm,
@@ -1151,6 +1235,12 @@ General Information)").c_str(),
 		m_revertStrings = *revertStrings;
 	}
 
+	if (m_args.count(g_argJobs) && m_args[g_argJobs].as<unsigned>() == 0)
+	{
+		serr() << "Invalid option for --" << g_strJobs << ": must be at least 1." << endl;
+		return false;
+	}
+
 	if (m_args.count(g_argCombinedJson))
 	{
 		vector<string> requests;
@@ -1207,8 +1297,8 @@ bool CommandLineInterface::processInput()
 
 			// NOTE: we ignore the FileNotFound exception as we manually check above
 			auto contents = readFileAsString(canonicalPath.string());
-			m_sourceCodes[path.generic_string()] = contents;
-			return ReadCallback::Result{true, contents};
+			m_sourceCodes[path.generic_string()] = CharStream(contents, path.generic_string());
+			return ReadCallback::Result{true, move(contents)};
 		}
 		catch (Exception const& _exception)
 		{
@@ -1482,6 +1572,18 @@ bool CommandLineInterface::processInput()
 		m_modelCheckerSettings.engine = *engine;
 	}
 
+	if (m_args.count(g_argModelCheckerSolverStrategy))
+	{
+		string strategyStr = m_args[g_argModelCheckerSolverStrategy].as<string>();
+		optional<smtutil::SMTPortfolioStrategy> strategy = solverStrategyFromString(strategyStr);
+		if (!strategy)
+		{
+			serr() << "Invalid option for --" << g_argModelCheckerSolverStrategy << ": " << strategyStr << endl;
+			return false;
+		}
+		m_modelCheckerSettings.solverStrategy = *strategy;
+	}
+
 	if (m_args.count(g_argModelCheckerTargets))
 	{
 		string targetsStr = m_args[g_argModelCheckerTargets].as<string>();
@@ -1507,7 +1609,11 @@ bool CommandLineInterface::processInput()
 			m_compiler->useMetadataLiteralSources(true);
 		if (m_args.count(g_argMetadataHash))
 			m_compiler->setMetadataHash(m_metadataHash);
-		if (m_args.count(g_argModelCheckerEngine) || m_args.count(g_argModelCheckerTimeout))
+		if (
+			m_args.count(g_argModelCheckerEngine) ||
+			m_args.count(g_argModelCheckerSolverStrategy) ||
+			m_args.count(g_argModelCheckerTimeout)
+		)
 			m_compiler->setModelCheckerSettings(m_modelCheckerSettings);
 		if (m_args.count(g_argInputFile))
 			m_compiler->setRemappings(m_remappings);
@@ -1516,11 +1622,18 @@ bool CommandLineInterface::processInput()
 			m_compiler->setLibraries(m_libraries);
 		if (m_args.count(g_argExperimentalViaIR))
 			m_compiler->setViaIR(true);
+		if (m_args.count(g_argJobs))
+			m_compiler->setParallelism(m_args[g_argJobs].as<unsigned>());
+		if (m_args.count(g_argCacheDir))
+			m_compiler->setCacheDirectory(m_args[g_argCacheDir].as<string>());
 		m_compiler->setEVMVersion(m_evmVersion);
 		m_compiler->setRevertStringBehaviour(m_revertStrings);
 		// TODO: Perhaps we should not compile unless requested
 
+		m_compiler->enableAssemblyItemGeneration(m_args.count(g_argGas));
 		m_compiler->enableIRGeneration(m_args.count(g_argIR) || m_args.count(g_argIROptimized));
+		m_compiler->enableYulOptimiserProfiling(m_args.count(g_argYulOptimizerProfile));
+		m_compiler->enableTimeReport(m_args.count(g_argTimeReport));
 		m_compiler->enableEwasmGeneration(m_args.count(g_argEwasm));
 
 		OptimiserSettings settings = m_args.count(g_argOptimize) ? OptimiserSettings::standard() : OptimiserSettings::minimal();
@@ -1571,7 +1684,10 @@ bool CommandLineInterface::processInput()
 		}
 		else
 		{
-			m_compiler->setSources(m_sourceCodes);
+			vector<CharStream> sources;
+			for (auto const& sourceCode: m_sourceCodes)
+				sources.push_back(sourceCode.second);
+			m_compiler->setCharStreams(move(sources));
 			if (m_args.count(g_argErrorRecovery))
 				m_compiler->setParserErrorRecovery(true);
 		}
@@ -1805,8 +1921,9 @@ bool CommandLineInterface::link()
 	}
 	for (auto& src: m_sourceCodes)
 	{
-		auto end = src.second.end();
-		for (auto it = src.second.begin(); it != end;)
+		string code{src.second.source()};
+		auto end = code.end();
+		for (auto it = code.begin(); it != end;)
 		{
 			while (it != end && *it != '_') ++it;
 			if (it == end) break;
@@ -1817,7 +1934,7 @@ bool CommandLineInterface::link()
 				*(it + placeholderSize - 1) != '_'
 			)
 			{
-				serr() << "Error in binary object file " << src.first << " at position " << (it - src.second.begin()) << endl;
+				serr() << "Error in binary object file " << src.first << " at position " << (it - code.begin()) << endl;
 				serr() << '"' << string(it, it + min(placeholderSize, static_cast<int>(end - it))) << "\" is not a valid link reference." << endl;
 				return false;
 			}
@@ -1834,9 +1951,10 @@ bool CommandLineInterface::link()
 		}
 		// Remove hints for resolved libraries.
 		for (auto const& library: m_libraries)
-			boost::algorithm::erase_all(src.second, "\n" + libraryPlaceholderHint(library.first));
-		while (!src.second.empty() && *prev(src.second.end()) == '\n')
-			src.second.resize(src.second.size() - 1);
+			boost::algorithm::erase_all(code, "\n" + libraryPlaceholderHint(library.first));
+		while (!code.empty() && *prev(code.end()) == '\n')
+			code.resize(code.size() - 1);
+		src.second = CharStream(move(code), src.first);
 	}
 	return true;
 }
@@ -1845,11 +1963,11 @@ void CommandLineInterface::writeLinkedFiles()
 {
 	for (auto const& src: m_sourceCodes)
 		if (src.first == g_stdinFileName)
-			sout() << src.second << endl;
+			sout() << src.second.source() << endl;
 		else
 		{
 			ofstream outFile(src.first);
-			outFile << src.second;
+			outFile << src.second.source();
 			if (!outFile)
 			{
 				serr() << "Could not write to file " << src.first << ". Aborting." << endl;
@@ -1894,9 +2012,11 @@ bool CommandLineInterface::assemble(
 			settings.yulOptimiserSteps = _yulOptimiserSteps.value();
 
 		auto& stack = assemblyStacks[src.first] = yul::AssemblyStack(m_evmVersion, _language, settings);
+		if (m_args.count(g_argJobs))
+			stack.setOptimiserParallelism(m_args[g_argJobs].as<unsigned>());
 		try
 		{
-			if (!stack.parseAndAnalyze(src.first, src.second))
+			if (!stack.parseAndAnalyze(src.first, string(src.second.source())))
 				successful = false;
 			else
 				stack.optimize();
@@ -2029,6 +2149,8 @@ void CommandLineInterface::outputCompilationResults()
 	// do we need AST output?
 	handleAst();
 
+	handleTimeReport();
+
 	if (
 		!m_compiler->compilationSuccessful() &&
 		m_stopAfter == CompilerStack::State::CompilationSuccessful
@@ -2038,6 +2160,11 @@ void CommandLineInterface::outputCompilationResults()
 		return;
 	}
 
+	// The assembly printer needs the sources as strings, which are only copied once for all contracts.
+	StringMap assemblySources;
+	if (m_args.count(g_argAsm) && !m_args.count(g_argAsmJson))
+		assemblySources = sourceStrings(m_sourceCodes);
+
 	vector<string> contracts = m_compiler->contractNames();
 	for (string const& contract: contracts)
 	{
@@ -2051,7 +2178,7 @@ void CommandLineInterface::outputCompilationResults()
 			if (m_args.count(g_argAsmJson))
 				ret = jsonPrettyPrint(removeNullMembers(m_compiler->assemblyJSON(contract)));
 			else
-				ret = m_compiler->assemblyString(contract, m_sourceCodes);
+				ret = m_compiler->assemblyString(contract, assemblySources);
 
 			if (m_args.count(g_argOutputDir))
 			{
@@ -2069,6 +2196,7 @@ void CommandLineInterface::outputCompilationResults()
 		handleBytecode(contract);
 		handleIR(contract);
 		handleIROptimized(contract);
+		handleYulOptimizerProfile(contract);
 		handleEwasm(contract);
 		handleSignatureHashes(contract);
 		handleMetadata(contract);
@@ -25,6 +25,7 @@
 #include <libsolidity/interface/CompilerStack.h>
 #include <libsolidity/interface/DebugSettings.h>
 #include <libyul/AssemblyStack.h>
+#include <liblangutil/CharStream.h>
 #include <liblangutil/EVMVersion.h>
 
 #include <boost/program_options.hpp>
@@ -72,6 +73,8 @@ private:
 	void handleOpcode(std::string const& _contract);
 	void handleIR(std::string const& _contract);
 	void handleIROptimized(std::string const& _contract);
+	void handleYulOptimizerProfile(std::string const& _contract);
+	void handleTimeReport();
 	void handleEwasm(std::string const& _contract);
 	void handleBytecode(std::string const& _contract);
 	void handleSignatureHashes(std::string const& _contract);
@@ -114,8 +117,8 @@ private:
 
 	/// Compiler arguments variable map
 	boost::program_options::variables_map m_args;
-	/// map of input files to source code strings
-	std::map<std::string, std::string> m_sourceCodes;
+	/// map of input files to their contents, which are shared with the compiler
+	std::map<std::string, langutil::CharStream> m_sourceCodes;
 	/// list of remappings
 	std::vector<frontend::CompilerStack::Remapping> m_remappings;
 	/// list of allowed directories to read files from
@@ -280,6 +280,39 @@ BOOST_AUTO_TEST_CASE(subobject_encode_decode)
 	BOOST_CHECK(assembly.decodeSubPath(assembly.encodeSubPath(subPath)) == subPath);
 }
 
+BOOST_AUTO_TEST_CASE(item_data)
+{
+	u256 const small = 0xffffffffffffffff;
+	u256 const large = u256(1) << 64;
+	u256 const huge = ~u256(0);
+
+	for (u256 const& value: {u256(0), small, large, huge})
+	{
+		AssemblyItem item(value);
+		BOOST_CHECK_EQUAL(item.data(), value);
+		BOOST_CHECK(item == AssemblyItem(value));
+	}
+	BOOST_CHECK(AssemblyItem(large) != AssemblyItem(huge));
+	BOOST_CHECK(AssemblyItem(small) != AssemblyItem(large));
+	BOOST_CHECK(AssemblyItem(PushData, large) != AssemblyItem(large));
+
+	BOOST_CHECK(AssemblyItem(u256(1)) < AssemblyItem(small));
+	BOOST_CHECK(AssemblyItem(small) < AssemblyItem(large));
+	BOOST_CHECK(!(AssemblyItem(large) < AssemblyItem(small)));
+	BOOST_CHECK(AssemblyItem(large) < AssemblyItem(huge));
+	BOOST_CHECK(!(AssemblyItem(huge) < AssemblyItem(huge)));
+
+	AssemblyItem item(PushTag, 3);
+	item.setData(huge);
+	BOOST_CHECK_EQUAL(item.data(), huge);
+	item.setData(small);
+	BOOST_CHECK_EQUAL(item.data(), small);
+	BOOST_CHECK(item == AssemblyItem(PushTag, small));
+
+	AssemblyItem tag = AssemblyItem(PushTag, 5).toSubAssemblyTag(7);
+	BOOST_CHECK(tag.splitForeignPushTag() == make_pair(size_t(7), size_t(5)));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
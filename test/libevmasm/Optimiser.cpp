@@ -50,7 +50,7 @@ namespace
 		// add dummy locations to each item so that we can check that they are not deleted
 		AssemblyItems input = _input;
 		for (AssemblyItem& item: input)
-			item.setLocation({1, 3, nullptr});
+			item.setLocation(SourceLocation{1, 3, nullptr});
 		return input;
 	}
 
@@ -741,6 +741,31 @@ BOOST_AUTO_TEST_CASE(cse_optimise_return)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(known_state_copies)
+{
+	KnownState state;
+	for (AssemblyItem const& item: AssemblyItems{u256(1), u256(2), Instruction::SSTORE, u256(7), u256(8)})
+		state.feedItem(item);
+
+	KnownState copy = state;
+	for (AssemblyItem const& item: AssemblyItems{u256(3), u256(4), Instruction::SSTORE, Instruction::SWAP1, Instruction::POP})
+		copy.feedItem(item);
+	BOOST_CHECK_EQUAL(state.storageContent().size(), 1);
+	BOOST_CHECK_EQUAL(copy.storageContent().size(), 2);
+
+	// Only the common storage and the common top of the stack remain.
+	KnownState other = copy;
+	copy.reduceToCommonKnowledge(state, true);
+	BOOST_CHECK_EQUAL(copy.storageContent().size(), 1);
+	BOOST_CHECK_EQUAL(copy.stackHeight(), 1);
+	BOOST_CHECK_EQUAL(copy.stackElements().size(), 1);
+	state.reduceToCommonKnowledge(other, true);
+	BOOST_CHECK_EQUAL(state.stackHeight(), 1);
+	BOOST_CHECK(state == copy);
+	BOOST_CHECK_EQUAL(other.storageContent().size(), 2);
+	BOOST_CHECK_EQUAL(other.stackHeight(), 1);
+}
+
 BOOST_AUTO_TEST_CASE(control_flow_graph_remove_unused)
 {
 	// remove parts of the code that are unused
@@ -1255,6 +1280,57 @@ BOOST_AUTO_TEST_CASE(jumpdest_removal_subassemblies)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(parallel_subassemblies)
+{
+	// Sub-assemblies that share a (nested) sub-assembly have to be optimised
+	// one after the other. The result must not depend on the number of threads.
+	auto createAssembly = []() {
+		auto createSub = []() {
+			AssemblyPointer sub = make_shared<Assembly>();
+			auto t1 = sub->newTag();
+			auto t2 = sub->newTag();
+			sub->append(t1.pushTag());
+			sub->append(Instruction::JUMP);
+			sub->append(t1);
+			sub->append(u256(7));
+			sub->append(Instruction::STOP);
+			sub->append(t2);
+			sub->append(u256(7));
+			sub->append(Instruction::STOP);
+			return sub;
+		};
+
+		AssemblyPointer main = make_shared<Assembly>();
+		AssemblyPointer shared = createSub();
+		AssemblyPointer nesting = createSub();
+		nesting->appendSubroutine(shared);
+		for (AssemblyPointer const& sub: {shared, createSub(), nesting, shared, createSub()})
+		{
+			size_t subId = static_cast<size_t>(main->appendSubroutine(sub).data());
+			main->append(AssemblyItem(PushTag, 2).toSubAssemblyTag(subId));
+		}
+		return main;
+	};
+
+	AssemblyPointer sequential = createAssembly();
+	sequential->optimise(true, solidity::test::CommonOptions::get().evmVersion(), true, 200);
+	for (size_t parallelism: vector<size_t>{2, 8})
+	{
+		AssemblyPointer parallel = createAssembly();
+		Assembly::OptimiserSettings settings;
+		settings.isCreation = true;
+		settings.runJumpdestRemover = true;
+		settings.runPeephole = true;
+		settings.runDeduplicate = true;
+		settings.runCSE = true;
+		settings.runConstantOptimiser = true;
+		settings.evmVersion = solidity::test::CommonOptions::get().evmVersion();
+		settings.parallelism = parallelism;
+		parallel->optimise(settings);
+		BOOST_CHECK_EQUAL(parallel->assemblyString(), sequential->assemblyString());
+	}
+}
+
 BOOST_AUTO_TEST_CASE(cse_sub_zero)
 {
 	checkCSE({
@@ -48,6 +48,37 @@ BOOST_AUTO_TEST_CASE(test_fail)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(shared_contents)
+{
+	auto buffer = std::make_shared<std::string const>("contract C {}");
+	std::weak_ptr<std::string const> weakBuffer = buffer;
+	CharStream stream(*buffer, buffer, "source");
+	buffer.reset();
+	BOOST_REQUIRE(!weakBuffer.expired());
+	BOOST_CHECK_EQUAL(stream.source(), "contract C {}");
+	BOOST_CHECK_EQUAL(stream.name(), "source");
+
+	CharStream copy = stream;
+	BOOST_CHECK(copy.source().data() == stream.source().data());
+	BOOST_CHECK('o' == copy.setPosition(1));
+	BOOST_CHECK('c' == stream.get());
+
+	stream = CharStream{};
+	copy = CharStream{};
+	BOOST_CHECK(weakBuffer.expired());
+}
+
+BOOST_AUTO_TEST_CASE(unterminated_contents)
+{
+	std::string const buffer = "abcx";
+	CharStream stream(std::string_view(buffer).substr(0, 3), nullptr, "source");
+	BOOST_CHECK('c' == stream.setPosition(2));
+	BOOST_CHECK(0 == stream.get(1));
+	BOOST_CHECK(0 == stream.advanceAndGet());
+	BOOST_CHECK(0 == stream.setPosition(3));
+	BOOST_CHECK(!stream.prefixMatch("cx"));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -0,0 +1,99 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the compact source locations.
+ */
+
+#include <liblangutil/CompactSourceLocation.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <set>
+#include <string>
+
+using namespace std;
+namespace solidity::langutil::test
+{
+
+BOOST_AUTO_TEST_SUITE(CompactSourceLocationTest)
+
+BOOST_AUTO_TEST_CASE(conversion)
+{
+	auto source = make_shared<CharStream>("{ let x := 1 }", "source.yul");
+	auto otherSource = make_shared<CharStream>("{ let x := 1 }", "source.yul");
+
+	SourceLocation location{2, 12, source};
+	CompactSourceLocation compact = location;
+	BOOST_CHECK_EQUAL(compact.start, 2);
+	BOOST_CHECK_EQUAL(compact.end, 12);
+	BOOST_CHECK(compact.hasSource());
+	BOOST_CHECK(SourceLocation(compact) == location);
+	BOOST_CHECK(SourceLocation(compact).source == source);
+
+	CompactSourceLocation other = SourceLocation{2, 12, otherSource};
+	BOOST_CHECK(compact != other);
+	BOOST_CHECK(compact == CompactSourceLocation(SourceLocation{2, 12, source}));
+	BOOST_CHECK(SourceLocation(other).source == otherSource);
+}
+
+BOOST_AUTO_TEST_CASE(without_source)
+{
+	CompactSourceLocation empty;
+	BOOST_CHECK(!empty.hasSource());
+	BOOST_CHECK(!SourceLocation(empty).isValid());
+
+	CompactSourceLocation compact = SourceLocation{3, 4, nullptr};
+	BOOST_CHECK(!compact.hasSource());
+	BOOST_CHECK(SourceLocation(compact) == (SourceLocation{3, 4, nullptr}));
+}
+
+BOOST_AUTO_TEST_CASE(releases_source)
+{
+	weak_ptr<CharStream> weakSource;
+	{
+		auto source = make_shared<CharStream>("{}", "temporary.yul");
+		weakSource = source;
+		CompactSourceLocation compact = SourceLocation{0, 2, source};
+		BOOST_CHECK(SourceLocation(compact).source == source);
+		BOOST_REQUIRE(compact.sourceName());
+		BOOST_CHECK_EQUAL(*compact.sourceName(), "temporary.yul");
+	}
+	BOOST_CHECK(weakSource.expired());
+}
+
+BOOST_AUTO_TEST_CASE(reuses_indices)
+{
+	// The indices of destroyed sources are reused, so the table does not grow if only
+	// few sources are alive at the same time.
+	set<uint32_t> indices;
+	for (size_t i = 0; i < 10000; ++i)
+	{
+		auto source = make_shared<CharStream>("{}", "temporary" + to_string(i) + ".yul");
+		CompactSourceLocation compact = SourceLocation{0, 2, source};
+		BOOST_CHECK(SourceLocation(compact).source == source);
+		BOOST_REQUIRE(compact.sourceName());
+		BOOST_CHECK_EQUAL(*compact.sourceName(), source->name());
+		indices.insert(compact.sourceIndex);
+	}
+	BOOST_CHECK_LT(indices.size(), 1000);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -761,6 +761,87 @@ BOOST_AUTO_TEST_CASE(multiline_comment_at_eos)
 	BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
 }
 
+// Whitespace, comments and identifiers are skipped in blocks of several characters,
+// so the following tests place their ends at all offsets within such a block.
+BOOST_AUTO_TEST_CASE(long_whitespace_and_identifiers)
+{
+	for (size_t length = 1; length < 40; ++length)
+	{
+		string const identifier = string(length, 'a') + "Z_$9";
+		Scanner scanner(CharStream(string(length, ' ') + identifier + string(length, '\n') + identifier + ".x", ""));
+		BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+		BOOST_CHECK_EQUAL(scanner.currentLiteral(), identifier);
+		BOOST_CHECK_EQUAL(scanner.currentLocation().start, static_cast<int>(length));
+		BOOST_CHECK_EQUAL(scanner.next(), Token::Identifier);
+		BOOST_CHECK_EQUAL(scanner.currentLiteral(), identifier);
+		BOOST_CHECK_EQUAL(scanner.next(), Token::Period);
+		BOOST_CHECK_EQUAL(scanner.next(), Token::Identifier);
+		BOOST_CHECK_EQUAL(scanner.currentLiteral(), "x");
+		BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
+
+		scanner.reset(CharStream("\t" + identifier + "." + identifier + "\xC3\xA4", ""));
+		scanner.setScannerMode(ScannerKind::Yul);
+		BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+		BOOST_CHECK_EQUAL(scanner.currentLiteral(), identifier + "." + identifier);
+		BOOST_CHECK_EQUAL(scanner.next(), Token::Illegal);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(long_comments)
+{
+	for (size_t length = 0; length < 40; ++length)
+	{
+		string const text(length, 'x');
+		Scanner scanner(CharStream("//" + text + "\xC3\xA4" + text + "\na /*" + text + "**" + text + "**/b /*" + text + "*", ""));
+		BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+		BOOST_CHECK_EQUAL(scanner.currentLiteral(), "a");
+		BOOST_CHECK_EQUAL(scanner.next(), Token::Identifier);
+		BOOST_CHECK_EQUAL(scanner.currentLiteral(), "b");
+		BOOST_CHECK_EQUAL(scanner.next(), Token::Illegal);
+		BOOST_CHECK_EQUAL(scanner.currentError(), ScannerError::IllegalCommentTerminator);
+		BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
+
+		scanner.reset(CharStream("//" + text + "\xE2\x80\xA8" + "a", ""));
+		BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Illegal);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(long_documentation_comments)
+{
+	for (size_t length = 0; length < 40; ++length)
+	{
+		string const text(length, 'x');
+		Scanner scanner(CharStream("/// " + text + "*" + text + "\n///" + text + "\xC3\xA4\na", ""));
+		BOOST_CHECK_EQUAL(scanner.currentCommentLiteral(), text + "*" + text + "\n" + text + "\xC3\xA4");
+		BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+
+		scanner.reset(CharStream("/** " + text + "*" + text + "\n * " + text + "**/a", ""));
+		BOOST_CHECK_EQUAL(scanner.currentCommentLiteral(), text + "*" + text + "\n " + text + "*");
+		BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+
+		scanner.reset(CharStream("a /// " + text, ""));
+		BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+		BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
+		BOOST_CHECK_EQUAL(scanner.currentCommentLiteral(), text);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(directional_override_in_long_comments)
+{
+	string const text(20, 'x');
+	Scanner scanner(CharStream("/*" + text + "\xE2\x80\xAE" + text + "*/ a", ""));
+	BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Illegal);
+	BOOST_CHECK_EQUAL(scanner.currentError(), ScannerError::DirectionalOverrideMismatch);
+
+	scanner.reset(CharStream("//" + text + "\xE2\x80\xAC" + text + "\n a", ""));
+	BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Illegal);
+	BOOST_CHECK_EQUAL(scanner.currentError(), ScannerError::DirectionalOverrideUnderflow);
+
+	scanner.reset(CharStream("/*" + text + "\xE2\x80\xAE" + text + "\xE2\x80\xAC*/ a", ""));
+	BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+	BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
+}
+
 BOOST_AUTO_TEST_CASE(regular_line_break_in_single_line_comment)
 {
 	for (auto const& nl: {"\r", "\n", "\r\n"})
@@ -0,0 +1,225 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the persistent compilation cache.
+ */
+
+#include <libsolidity/interface/CompilationCache.h>
+#include <libsolidity/interface/CompilerStack.h>
+
+#include <test/Common.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/JSON.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+
+using namespace std;
+using namespace solidity::util;
+
+namespace fs = boost::filesystem;
+
+namespace solidity::frontend::test
+{
+
+namespace
+{
+
+/// Creates a fresh directory and removes it again at the end of the test.
+struct CacheDirectoryFixture
+{
+	CacheDirectoryFixture(): directory(fs::temp_directory_path() / fs::unique_path("solc-cache-test-%%%%-%%%%-%%%%")) {}
+	~CacheDirectoryFixture()
+	{
+		boost::system::error_code error;
+		fs::remove_all(directory, error);
+	}
+
+	vector<fs::path> entries() const
+	{
+		vector<fs::path> result;
+		if (fs::exists(directory))
+			for (fs::directory_entry const& entry: fs::directory_iterator(directory))
+				result.emplace_back(entry.path());
+		return result;
+	}
+
+	string compileOptimizedIR() const
+	{
+		CompilerStack compiler;
+		compiler.setSources({{"", "pragma solidity >=0.0;\ncontract C { function f() public pure returns (uint) { return 42; } }"}});
+		compiler.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+		compiler.setOptimiserSettings(true);
+		compiler.enableIRGeneration();
+		compiler.enableEvmBytecodeGeneration(false);
+		compiler.setCacheDirectory(directory.string());
+		BOOST_REQUIRE(compiler.compile());
+		return compiler.yulIROptimized("C");
+	}
+
+	/// Compiles a contract that creates another one and @returns the outputs of the
+	/// code generator for both of them. The gas estimates are only included if
+	/// @a _gasEstimates is true.
+	map<string, vector<string>> compileContracts(bool _useCache, bool _viaIR = false, bool _gasEstimates = false) const
+	{
+		StringMap sources{{"a.sol",
+			"pragma solidity >=0.0;\n"
+			"contract B { uint public x; constructor(uint _x) { x = _x; } }\n"
+			"contract A { function f(uint _x) public returns (uint) { return new B(_x).x() + 1; } }\n"
+		}};
+		CompilerStack compiler;
+		compiler.setSources(sources);
+		compiler.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+		compiler.setOptimiserSettings(true);
+		compiler.setViaIR(_viaIR);
+		compiler.enableAssemblyItemGeneration(_gasEstimates);
+		if (_useCache)
+			compiler.setCacheDirectory(directory.string());
+		BOOST_REQUIRE(compiler.compile());
+
+		map<string, vector<string>> outputs;
+		for (string const& name: vector<string>{"a.sol:A", "a.sol:B"})
+		{
+			outputs[name] = {compiler.object(name).toHex(), compiler.runtimeObject(name).toHex()};
+			if (_viaIR)
+				continue;
+			outputs[name] += vector<string>{
+				compiler.assemblyString(name, sources),
+				jsonCompactPrint(compiler.assemblyJSON(name)),
+				*compiler.sourceMapping(name),
+				*compiler.runtimeSourceMapping(name),
+				jsonCompactPrint(compiler.generatedSources(name)),
+				jsonCompactPrint(compiler.generatedSources(name, true))
+			};
+			if (_gasEstimates)
+				outputs[name].emplace_back(jsonCompactPrint(compiler.gasEstimates(name)));
+		}
+		return outputs;
+	}
+
+	/// Sets the member @a _member of all cache entries for the code of contracts to @a _value.
+	void modifyEntries(string const& _member, Json::Value const& _value) const
+	{
+		for (fs::path const& entry: entries())
+		{
+			Json::Value json;
+			// Skip the entries for the optimized IR.
+			if (!jsonParseStrict(readFileAsString(entry.string()), json))
+				continue;
+			json[_member] = _value;
+			ofstream(entry.string(), ios::trunc) << jsonCompactPrint(json);
+		}
+	}
+
+	fs::path directory;
+};
+
+}
+
+BOOST_FIXTURE_TEST_SUITE(CompilationCacheTest, CacheDirectoryFixture)
+
+BOOST_AUTO_TEST_CASE(load_and_store)
+{
+	CompilationCache cache(directory);
+	h256 key = CompilationCache::key("test", {"input"});
+	BOOST_CHECK(!cache.load(key).has_value());
+
+	cache.store(key, string("value\0with zero", 15));
+	BOOST_REQUIRE(cache.load(key).has_value());
+	BOOST_CHECK_EQUAL(*cache.load(key), string("value\0with zero", 15));
+
+	cache.store(key, "other value");
+	BOOST_CHECK_EQUAL(*cache.load(key), "other value");
+	BOOST_CHECK_EQUAL(entries().size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(keys)
+{
+	BOOST_CHECK(CompilationCache::key("a", {"b"}) == CompilationCache::key("a", {"b"}));
+	BOOST_CHECK(CompilationCache::key("a", {"b"}) != CompilationCache::key("b", {"b"}));
+	BOOST_CHECK(CompilationCache::key("a", {"b"}) != CompilationCache::key("a", {"c"}));
+	BOOST_CHECK(CompilationCache::key("a", {"bc", ""}) != CompilationCache::key("a", {"b", "c"}));
+}
+
+BOOST_AUTO_TEST_CASE(inaccessible_directory)
+{
+	// A regular file in place of the directory only results in cache misses.
+	fs::create_directories(directory);
+	fs::path file = directory / "file";
+	ofstream(file.string()) << "not a directory";
+
+	CompilationCache cache(file);
+	h256 key = CompilationCache::key("test", {"input"});
+	cache.store(key, "value");
+	BOOST_CHECK(!cache.load(key).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(optimized_ir)
+{
+	string optimizedIR = compileOptimizedIR();
+	BOOST_CHECK(!optimizedIR.empty());
+	vector<fs::path> cacheEntries = entries();
+	BOOST_REQUIRE_EQUAL(cacheEntries.size(), 1);
+	BOOST_CHECK_EQUAL(compileOptimizedIR(), optimizedIR);
+
+	// The second run takes the result from the cache instead of running the optimizer.
+	ofstream(cacheEntries.front().string(), ios::trunc) << "/* from cache */";
+	BOOST_CHECK_EQUAL(compileOptimizedIR(), "/* from cache */");
+}
+
+BOOST_AUTO_TEST_CASE(contract_code)
+{
+	map<string, vector<string>> outputs = compileContracts(false);
+	BOOST_CHECK(compileContracts(true) == outputs);
+	BOOST_CHECK_EQUAL(entries().size(), 2);
+	// All outputs are the same if the code is taken from the cache.
+	BOOST_CHECK(compileContracts(true) == outputs);
+	BOOST_CHECK_EQUAL(entries().size(), 2);
+
+	modifyEntries("assembly", "/* from cache */");
+	for (auto const& [name, contractOutputs]: compileContracts(true))
+		BOOST_CHECK_EQUAL(contractOutputs.at(2), "/* from cache */");
+
+	// The gas estimates need the assembly items, which are not cached, so the code is generated again.
+	map<string, vector<string>> outputsWithGas = compileContracts(false, false, true);
+	BOOST_CHECK(compileContracts(true, false, true) == outputsWithGas);
+	BOOST_CHECK_EQUAL(entries().size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(contract_code_via_ir)
+{
+	map<string, vector<string>> outputs = compileContracts(false, true);
+	BOOST_CHECK(compileContracts(true, true) == outputs);
+	BOOST_CHECK(compileContracts(true, true) == outputs);
+
+	// The second run takes the code from the cache instead of running the code generator.
+	Json::Value bytecode{Json::objectValue};
+	bytecode["object"] = "6001";
+	bytecode["linkReferences"] = Json::objectValue;
+	bytecode["immutableReferences"] = Json::arrayValue;
+	modifyEntries("bytecode", bytecode);
+	for (auto const& [name, contractOutputs]: compileContracts(true, true))
+		BOOST_CHECK_EQUAL(contractOutputs.at(0), "6001");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,185 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for updating the sources of an analysed CompilerStack.
+ */
+
+#include <test/Common.h>
+
+#include <liblangutil/Exceptions.h>
+
+#include <libsolidity/ast/AST.h>
+#include <libsolidity/ast/ASTVisitor.h>
+#include <libsolidity/interface/CompilerStack.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+
+using namespace std;
+using namespace solidity::langutil;
+
+namespace solidity::frontend::test
+{
+
+namespace
+{
+
+StringMap const sources{
+	{"a.sol", "// SPDX-License-Identifier: GPL-3.0\npragma solidity >=0.0; library L { struct S { uint x; } function get(S storage s) internal view returns (uint) { return s.x; } }"},
+	{"b.sol", "// SPDX-License-Identifier: GPL-3.0\npragma solidity >=0.0; import \"a.sol\"; contract B { L.S s; function f() public view returns (uint) { return L.get(s); } }"},
+	{"c.sol", "// SPDX-License-Identifier: GPL-3.0\npragma solidity >=0.0; contract C { function g() public pure { uint unused; } }"}
+};
+
+/// @returns the number of errors of the given type, ignoring those without source location
+/// like the pre-release warning.
+size_t countErrors(CompilerStack const& _compiler, Error::Type _type)
+{
+	size_t count = 0;
+	for (auto const& error: _compiler.errors())
+		if (error->type() == _type && boost::get_error_info<errinfo_sourceLocation>(*error))
+			++count;
+	return count;
+}
+
+/// @returns the smallest ID of the nodes of @a _sourceUnit.
+int64_t smallestNodeID(SourceUnit const& _sourceUnit)
+{
+	struct SmallestNodeID: ASTConstVisitor
+	{
+		bool visitNode(ASTNode const& _node) override
+		{
+			id = min(id, _node.id());
+			return true;
+		}
+		int64_t id = numeric_limits<int64_t>::max();
+	};
+	SmallestNodeID visitor;
+	_sourceUnit.accept(visitor);
+	return visitor.id;
+}
+
+string bytecode(StringMap const& _sources, string const& _contractName)
+{
+	CompilerStack compiler;
+	compiler.setSources(_sources);
+	compiler.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+	BOOST_REQUIRE(compiler.compile());
+	return compiler.object(_contractName).toHex();
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(IncrementalAnalysis)
+
+BOOST_AUTO_TEST_CASE(unchanged_sources_are_reused)
+{
+	StringMap updatedSources = sources;
+	updatedSources["b.sol"] = "// SPDX-License-Identifier: GPL-3.0\npragma solidity >=0.0; import \"a.sol\"; contract B { L.S s; function f() public view returns (uint) { return L.get(s) + 1; } }";
+	string expectedB = bytecode(updatedSources, "b.sol:B");
+	string expectedC = bytecode(updatedSources, "c.sol:C");
+
+	CompilerStack compiler;
+	compiler.setSources(sources);
+	compiler.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+	BOOST_REQUIRE(compiler.compile());
+	SourceUnit const* a = &compiler.ast("a.sol");
+	SourceUnit const* b = &compiler.ast("b.sol");
+	SourceUnit const* c = &compiler.ast("c.sol");
+	BOOST_CHECK_EQUAL(countErrors(compiler, Error::Type::Warning), 1);
+
+	BOOST_REQUIRE(compiler.updateSources({{"b.sol", updatedSources["b.sol"]}}));
+	BOOST_CHECK(&compiler.ast("a.sol") == a);
+	BOOST_CHECK(&compiler.ast("b.sol") != b);
+	BOOST_CHECK(&compiler.ast("c.sol") == c);
+	// The warning about the unused variable in the reused source is still reported.
+	BOOST_CHECK_EQUAL(countErrors(compiler, Error::Type::Warning), 1);
+
+	BOOST_REQUIRE(compiler.compile());
+	BOOST_CHECK_EQUAL(compiler.object("b.sol:B").toHex(), expectedB);
+	BOOST_CHECK_EQUAL(compiler.object("c.sol:C").toHex(), expectedC);
+}
+
+BOOST_AUTO_TEST_CASE(importing_sources_are_analysed_again)
+{
+	CompilerStack compiler;
+	compiler.setSources(sources);
+	compiler.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+	BOOST_REQUIRE(compiler.parseAndAnalyze());
+	SourceUnit const* b = &compiler.ast("b.sol");
+	SourceUnit const* c = &compiler.ast("c.sol");
+
+	// Changing the library breaks the contract that uses it.
+	BOOST_CHECK(!compiler.updateSources({
+		{"a.sol", "// SPDX-License-Identifier: GPL-3.0\npragma solidity >=0.0; library L { struct S { uint x; } }"}
+	}));
+	BOOST_CHECK(&compiler.ast("b.sol") != b);
+	BOOST_CHECK(&compiler.ast("c.sol") == c);
+	BOOST_CHECK_EQUAL(countErrors(compiler, Error::Type::TypeError), 1);
+
+	// After an error, everything is analysed again.
+	BOOST_REQUIRE(compiler.updateSources({{"a.sol", sources.at("a.sol")}}));
+	BOOST_CHECK(&compiler.ast("c.sol") != c);
+	BOOST_CHECK_EQUAL(countErrors(compiler, Error::Type::Warning), 1);
+	BOOST_CHECK(compiler.compile());
+}
+
+BOOST_AUTO_TEST_CASE(new_sources)
+{
+	CompilerStack compiler;
+	compiler.setSources(sources);
+	compiler.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+	BOOST_REQUIRE(compiler.parseAndAnalyze());
+	SourceUnit const* a = &compiler.ast("a.sol");
+
+	BOOST_REQUIRE(compiler.updateSources({
+		{"d.sol", "// SPDX-License-Identifier: GPL-3.0\npragma solidity >=0.0; import \"b.sol\"; contract D is B {}"}
+	}));
+	BOOST_CHECK(&compiler.ast("a.sol") == a);
+	BOOST_REQUIRE(compiler.compile());
+	BOOST_CHECK(!compiler.object("d.sol:D").bytecode.empty());
+
+	// Updating with identical sources does not do anything.
+	SourceUnit const* d = &compiler.ast("d.sol");
+	BOOST_CHECK(compiler.updateSources({{"d.sol", "// SPDX-License-Identifier: GPL-3.0\npragma solidity >=0.0; import \"b.sol\"; contract D is B {}"}}));
+	BOOST_CHECK(&compiler.ast("d.sol") == d);
+}
+
+BOOST_AUTO_TEST_CASE(node_ids_are_not_reused)
+{
+	CompilerStack compiler;
+	compiler.setSources(sources);
+	compiler.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+	BOOST_REQUIRE(compiler.parseAndAnalyze());
+
+	// The new nodes get larger IDs than the nodes of all previous source units, including
+	// the ones that were replaced.
+	int64_t lastNodeID = 0;
+	for (string const& name: compiler.sourceNames())
+		lastNodeID = max(lastNodeID, compiler.ast(name).id());
+	for (string content: {"contract C1 {}", "contract C2 { function g() public {} }"})
+	{
+		BOOST_REQUIRE(compiler.updateSources({{"c.sol", "// SPDX-License-Identifier: GPL-3.0\npragma solidity >=0.0; " + content}}));
+		BOOST_CHECK_GT(smallestNodeID(compiler.ast("c.sol")), lastNodeID);
+		lastNodeID = compiler.ast("c.sol").id();
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
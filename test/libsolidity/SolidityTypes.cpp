@@ -33,7 +33,14 @@ using namespace solidity::langutil;
 namespace solidity::frontend::test
 {
 
-BOOST_AUTO_TEST_SUITE(SolidityTypes)
+/// Contract, struct and enum types are shared by the addresses of their AST nodes, which
+/// only live for one test case, so the types must not be reused by later test cases.
+struct TypeProviderResetFixture
+{
+	~TypeProviderResetFixture() { TypeProvider::reset(); }
+};
+
+BOOST_FIXTURE_TEST_SUITE(SolidityTypes, TypeProviderResetFixture)
 
 BOOST_AUTO_TEST_CASE(int_types)
 {
@@ -218,6 +225,28 @@ BOOST_AUTO_TEST_CASE(type_identifiers)
 	BOOST_CHECK_EQUAL(InaccessibleDynamicType().identifier(), "t_inaccessible");
 }
 
+BOOST_AUTO_TEST_CASE(type_names_computed_once)
+{
+	TypePointer stringArray = TypeProvider::array(DataLocation::Memory, TypeProvider::stringMemory(), u256(3));
+	TypePointer nestedArray = TypeProvider::array(DataLocation::Memory, stringArray);
+	for (TypePointer type: {stringArray, nestedArray})
+	{
+		BOOST_CHECK_EQUAL(&type->richIdentifier(), &type->richIdentifier());
+		BOOST_CHECK_EQUAL(&type->identifier(), &type->identifier());
+		BOOST_CHECK_EQUAL(&type->toString(true), &type->toString(true));
+		BOOST_CHECK_EQUAL(&type->toString(false), &type->toString(false));
+		BOOST_CHECK_EQUAL(&type->canonicalName(), &type->canonicalName());
+	}
+	BOOST_CHECK_EQUAL(nestedArray->identifier(), "t_array$_t_array$_t_string_memory_ptr_$3_memory_ptr_$dyn_memory_ptr");
+	BOOST_CHECK_EQUAL(nestedArray->toString(true), "string[3][]");
+	BOOST_CHECK_EQUAL(nestedArray->toString(false), "string memory[3] memory[] memory");
+	BOOST_CHECK_EQUAL(nestedArray->canonicalName(), "string[3][]");
+
+	// Clearing the cached values keeps the names.
+	nestedArray->clearCache();
+	BOOST_CHECK_EQUAL(nestedArray->toString(true), "string[3][]");
+}
+
 BOOST_AUTO_TEST_CASE(encoded_sizes)
 {
 	BOOST_CHECK_EQUAL(IntegerType(16).calldataEncodedSize(true), 32);
@@ -29,6 +29,8 @@
 #include <libsolutil/CommonData.h>
 #include <test/Metadata.h>
 
+#include <boost/filesystem.hpp>
+
 #include <algorithm>
 #include <set>
 
@@ -1755,6 +1757,297 @@ BOOST_AUTO_TEST_CASE(dependency_tracking_of_abstract_contract_yul)
 	BOOST_REQUIRE(result["sources"].size() == 1);
 }
 
+BOOST_AUTO_TEST_CASE(concurrent_analysis)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"A.sol": {
+				"content": "pragma solidity >=0.0; import \"B.sol\"; contract A is B { function f() public onlyOwner returns (uint) { uint x; return 1; } }"
+			},
+			"B.sol": {
+				"content": "pragma solidity >=0.0; contract B { uint s; modifier onlyOwner { require(s == 0); _; } function g() public returns (uint) { return s; } }"
+			},
+			"C.sol": {
+				"content": "pragma solidity >=0.0; contract C { function h(uint a) public returns (uint) { return 2; revert(); } }"
+			}
+		},
+		"settings": {
+			"outputSelection": {
+				"*": { "": ["ast"] }
+			}
+		}
+	}
+	)";
+
+	Json::Value parsedInput;
+	BOOST_REQUIRE(util::jsonParseStrict(input, parsedInput));
+
+	solidity::frontend::StandardCompiler compiler;
+	Json::Value serialResult = compiler.compile(parsedInput);
+	BOOST_CHECK(containsAtMostWarnings(serialResult));
+	BOOST_REQUIRE(serialResult["errors"].isArray());
+	// At least an unused variable, an unused parameter, unreachable code and three
+	// functions whose state mutability can be restricted.
+	BOOST_CHECK(serialResult["errors"].size() >= 6);
+
+	parsedInput["settings"]["parallelism"] = 4;
+	for (size_t i = 0; i < 10; ++i)
+	{
+		Json::Value concurrentResult = compiler.compile(parsedInput);
+		BOOST_CHECK(concurrentResult["errors"] == serialResult["errors"]);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_legacy_compilation)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"A.sol": {
+				"content": "pragma solidity >=0.0; import \"B.sol\"; contract A { B b = new B(); function f() public returns (uint) { uint x; return b.g(); } }"
+			},
+			"B.sol": {
+				"content": "pragma solidity >=0.0; library L { function l(uint a) internal pure returns (uint) { return a + 1; } } contract B { uint s; function g() public returns (uint) { return L.l(s); } }"
+			},
+			"C.sol": {
+				"content": "pragma solidity >=0.0; import \"B.sol\"; contract C { function h() public pure returns (bytes memory) { return type(B).creationCode; } }"
+			},
+			"D.sol": {
+				"content": "pragma solidity >=0.0; contract D { function k(uint a) public pure returns (uint r) { assembly { r := mul(a, 3) } } }"
+			},
+			"E.sol": {
+				"content": "pragma solidity >=0.0; contract E { event Ev(uint); function m() public { emit Ev(block.number); } }"
+			}
+		},
+		"settings": {
+			"optimizer": { "enabled": true },
+			"outputSelection": {
+				"*": { "*": ["evm.bytecode.object", "evm.deployedBytecode.object", "evm.assembly", "ir", "metadata"] }
+			}
+		}
+	}
+	)";
+
+	Json::Value parsedInput;
+	BOOST_REQUIRE(util::jsonParseStrict(input, parsedInput));
+
+	solidity::frontend::StandardCompiler compiler;
+	Json::Value serialResult = compiler.compile(parsedInput);
+	BOOST_CHECK(containsAtMostWarnings(serialResult));
+	BOOST_REQUIRE(serialResult["contracts"].size() == 5);
+	BOOST_REQUIRE(serialResult["errors"].isArray());
+
+	parsedInput["settings"]["parallelism"] = 4;
+	for (size_t i = 0; i < 10; ++i)
+	{
+		Json::Value concurrentResult = compiler.compile(parsedInput);
+		BOOST_CHECK(concurrentResult["contracts"] == serialResult["contracts"]);
+		BOOST_CHECK(concurrentResult["errors"] == serialResult["errors"]);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(cache_directory)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"A.sol": {
+				"content": "pragma solidity >=0.0; import \"B.sol\"; contract A { B b = new B(); function f() public returns (uint) { return b.g(); } }"
+			},
+			"B.sol": {
+				"content": "pragma solidity >=0.0; contract B { uint s; function g() public returns (uint) { return s + 1; } }"
+			}
+		},
+		"settings": {
+			"optimizer": { "enabled": true },
+			"outputSelection": {
+				"*": { "*": ["evm.bytecode", "evm.deployedBytecode", "evm.assembly", "evm.legacyAssembly", "evm.gasEstimates", "metadata"] }
+			}
+		}
+	}
+	)";
+
+	Json::Value parsedInput;
+	BOOST_REQUIRE(util::jsonParseStrict(input, parsedInput));
+
+	namespace fs = boost::filesystem;
+	fs::path directory = fs::temp_directory_path() / fs::unique_path("solc-cache-test-%%%%-%%%%-%%%%");
+	solidity::frontend::StandardCompiler compiler;
+	// The code is only taken from the cache if the gas estimates are not requested,
+	// since they need the assembly items, which are not cached.
+	for (bool gasEstimates: {true, false})
+	{
+		if (!gasEstimates)
+		{
+			Json::Value outputs{Json::arrayValue};
+			for (auto const& output: parsedInput["settings"]["outputSelection"]["*"]["*"])
+				if (output != "evm.gasEstimates")
+					outputs.append(output);
+			parsedInput["settings"]["outputSelection"]["*"]["*"] = outputs;
+		}
+		parsedInput["settings"].removeMember("cacheDirectory");
+		parsedInput["settings"].removeMember("parallelism");
+		Json::Value uncachedResult = compiler.compile(parsedInput);
+		BOOST_CHECK(containsAtMostWarnings(uncachedResult));
+		BOOST_REQUIRE(uncachedResult["contracts"].size() == 2);
+
+		parsedInput["settings"]["cacheDirectory"] = directory.string();
+		for (int parallelism: {1, 4, 1})
+		{
+			parsedInput["settings"]["parallelism"] = parallelism;
+			Json::Value result = compiler.compile(parsedInput);
+			BOOST_CHECK(result["contracts"] == uncachedResult["contracts"]);
+			BOOST_CHECK(result["errors"] == uncachedResult["errors"]);
+		}
+	}
+	BOOST_CHECK(!fs::is_empty(directory));
+	boost::system::error_code error;
+	fs::remove_all(directory, error);
+
+	parsedInput["settings"]["cacheDirectory"] = 1;
+	BOOST_CHECK(containsError(compiler.compile(parsedInput), "JSONError", "\"settings.cacheDirectory\" must be a string."));
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_analysis_warning_limit)
+{
+	Json::Value input;
+	input["language"] = "Solidity";
+	input["settings"]["outputSelection"]["*"][""][0] = "ast";
+	for (string const& name: vector<string>{"A", "B", "C"})
+	{
+		string content = "pragma solidity >=0.0; contract " + name + " { function f() public { ";
+		for (size_t i = 0; i < 150; ++i)
+			content += "uint x" + to_string(i) + "; ";
+		input["sources"][name + ".sol"]["content"] = content + "} }";
+	}
+
+	solidity::frontend::StandardCompiler compiler;
+	Json::Value serialResult = compiler.compile(input);
+	BOOST_CHECK(containsAtMostWarnings(serialResult));
+	BOOST_REQUIRE(serialResult["errors"].isArray());
+	BOOST_CHECK_EQUAL(serialResult["errors"].size(), 256);
+	BOOST_CHECK_EQUAL(serialResult["errors"][255]["message"].asString(), "There are more than 256 warnings. Ignoring the rest.");
+
+	input["settings"]["parallelism"] = 4;
+	Json::Value concurrentResult = compiler.compile(input);
+	BOOST_CHECK(concurrentResult["errors"] == serialResult["errors"]);
+}
+
+BOOST_AUTO_TEST_CASE(time_report)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"A.sol": {
+				"content": "contract C { function f(uint x) public pure returns (uint) { return x * 2 + 1; } }"
+			}
+		},
+		"settings": {
+			"outputSelection": {
+				"A.sol": {
+					"": ["timeReport"],
+					"C": ["evm.bytecode.object"]
+				}
+			}
+		}
+	}
+	)";
+
+	Json::Value parsedInput;
+	BOOST_REQUIRE(util::jsonParseStrict(input, parsedInput));
+
+	solidity::frontend::StandardCompiler compiler;
+	Json::Value result = compiler.compile(parsedInput);
+
+	BOOST_CHECK(containsAtMostWarnings(result));
+	Json::Value const& report = result["timeReport"];
+	BOOST_REQUIRE(report.isObject());
+	for (string phase: {"parsing", "analysis", "compilation"})
+		BOOST_CHECK(report[phase]["time"].isInt64());
+	BOOST_CHECK(report["analysis"]["steps"]["TypeChecker"].isInt64());
+	Json::Value const& contract = report["compilation"]["contracts"]["A.sol:C"];
+	BOOST_REQUIRE(contract.isObject());
+	BOOST_CHECK(contract["time"].isInt64());
+	BOOST_CHECK(contract["steps"]["codeGeneration"].isInt64());
+
+	// Not included unless requested explicitly.
+	parsedInput["settings"]["outputSelection"]["A.sol"][""] = Json::arrayValue;
+	parsedInput["settings"]["outputSelection"]["A.sol"][""].append("*");
+	result = compiler.compile(parsedInput);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	BOOST_CHECK(!result.isMember("timeReport"));
+}
+
+BOOST_AUTO_TEST_CASE(yul_optimizer_profile)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"A.sol": {
+				"content": "contract C { function f(uint x) public pure returns (uint) { return x * 2 + 1; } }"
+			}
+		},
+		"settings": {
+			"optimizer": { "enabled": true, "details": { "yul": true } },
+			"outputSelection": {
+				"A.sol": {
+					"C": ["yulOptimizerProfile"]
+				}
+			}
+		}
+	}
+	)";
+
+	Json::Value parsedInput;
+	BOOST_REQUIRE(util::jsonParseStrict(input, parsedInput));
+
+	solidity::frontend::StandardCompiler compiler;
+	Json::Value result = compiler.compile(parsedInput);
+
+	BOOST_CHECK(containsAtMostWarnings(result));
+	Json::Value contract = getContractResult(result, "A.sol", "C");
+	BOOST_REQUIRE(contract.isObject());
+	BOOST_CHECK(!contract.isMember("irOptimized"));
+	Json::Value const& profile = contract["yulOptimizerProfile"];
+	BOOST_REQUIRE(profile.isObject());
+	// One profile for the creation and one for the deployed object.
+	BOOST_REQUIRE_EQUAL(profile.size(), 2);
+	for (Json::Value const& objectProfile: profile)
+	{
+		BOOST_CHECK(objectProfile["time"].isUInt64());
+		BOOST_REQUIRE(objectProfile["steps"].isObject());
+		BOOST_CHECK(objectProfile["steps"]["s"]["name"].asString() == "ExpressionSimplifier");
+		BOOST_CHECK(objectProfile["steps"]["s"]["runs"].asUInt() > 0);
+		BOOST_REQUIRE(objectProfile["sequence"].isArray());
+		BOOST_REQUIRE(objectProfile["sequence"].size() > 0);
+		bool foundUntilStable = false;
+		for (Json::Value const& segment: objectProfile["sequence"])
+		{
+			BOOST_REQUIRE(segment["rounds"].isArray());
+			BOOST_REQUIRE(segment["rounds"].size() > 0);
+			BOOST_CHECK_EQUAL(segment["rounds"][0]["steps"].size(), segment["steps"].asString().size());
+			if (segment["untilStable"].asBool())
+				foundUntilStable = true;
+			else
+				BOOST_CHECK_EQUAL(segment["rounds"].size(), 1);
+		}
+		BOOST_CHECK(foundUntilStable);
+	}
+
+	// The wildcard does not select the profile.
+	parsedInput["settings"]["outputSelection"]["A.sol"]["C"] = Json::arrayValue;
+	parsedInput["settings"]["outputSelection"]["A.sol"]["C"].append("*");
+	result = compiler.compile(parsedInput);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	BOOST_CHECK(!getContractResult(result, "A.sol", "C").isMember("yulOptimizerProfile"));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
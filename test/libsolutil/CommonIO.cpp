@@ -0,0 +1,88 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the file I/O routines.
+ */
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/Exceptions.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace solidity::util::test
+{
+
+namespace
+{
+
+/// Creates a file name in the temporary directory and removes the file again at the end of the test.
+struct TemporaryFileFixture
+{
+	TemporaryFileFixture(): file(fs::temp_directory_path() / fs::unique_path("solc-io-test-%%%%-%%%%-%%%%")) {}
+	~TemporaryFileFixture()
+	{
+		boost::system::error_code error;
+		fs::remove(file, error);
+	}
+
+	void write(string const& _contents) const
+	{
+		ofstream stream(file.string(), ios::binary);
+		stream << _contents;
+	}
+
+	fs::path file;
+};
+
+}
+
+BOOST_FIXTURE_TEST_SUITE(CommonIOTest, TemporaryFileFixture)
+
+BOOST_AUTO_TEST_CASE(mapped_file)
+{
+	string contents = "contract C {}\n";
+	for (size_t i = 0; i < 10000; ++i)
+		contents += "// " + to_string(i) + "\n";
+	write(contents);
+
+	MappedFile mappedFile(file.string());
+	BOOST_CHECK(mappedFile.contents() == contents);
+	BOOST_CHECK_EQUAL(readFileAsString(file.string()), contents);
+}
+
+BOOST_AUTO_TEST_CASE(mapped_empty_file)
+{
+	write("");
+	BOOST_CHECK(MappedFile(file.string()).contents().empty());
+}
+
+BOOST_AUTO_TEST_CASE(mapped_missing_file)
+{
+	BOOST_CHECK_THROW(MappedFile{file.string()}, FileNotFound);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
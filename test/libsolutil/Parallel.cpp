@@ -0,0 +1,133 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the parallel task helpers.
+ */
+
+#include <libsolutil/Parallel.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <future>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(ParallelTest)
+
+BOOST_AUTO_TEST_CASE(no_tasks)
+{
+	BOOST_CHECK(parallelFor(0, 4, [](size_t) { BOOST_FAIL("Task called."); }).empty());
+}
+
+BOOST_AUTO_TEST_CASE(every_index_once)
+{
+	for (size_t jobs: vector<size_t>{1, 2, 3, 16})
+	{
+		vector<atomic<unsigned>> calls(100);
+		vector<exception_ptr> exceptions = parallelFor(calls.size(), jobs, [&](size_t _index) { ++calls[_index]; });
+		BOOST_CHECK_EQUAL(exceptions.size(), calls.size());
+		for (size_t i = 0; i < calls.size(); ++i)
+		{
+			BOOST_CHECK_EQUAL(calls[i].load(), 1u);
+			BOOST_CHECK(!exceptions[i]);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(serial_order)
+{
+	vector<size_t> order;
+	parallelFor(5, 1, [&](size_t _index) { order.push_back(_index); });
+	BOOST_CHECK((order == vector<size_t>{0, 1, 2, 3, 4}));
+}
+
+BOOST_AUTO_TEST_CASE(exceptions)
+{
+	for (size_t jobs: vector<size_t>{1, 4})
+	{
+		vector<exception_ptr> exceptions = parallelFor(10, jobs, [](size_t _index) {
+			if (_index % 3 == 1)
+				throw runtime_error(to_string(_index));
+		});
+		BOOST_REQUIRE_EQUAL(exceptions.size(), 10);
+		for (size_t i = 0; i < exceptions.size(); ++i)
+			if (i % 3 == 1)
+				BOOST_CHECK_EXCEPTION(
+					rethrow_exception(exceptions[i]),
+					runtime_error,
+					[&](runtime_error const& _e) { return _e.what() == to_string(i); }
+				);
+			else
+				BOOST_CHECK(!exceptions[i]);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(nested)
+{
+	atomic<unsigned> calls{0};
+	vector<vector<exception_ptr>> innerExceptions(4);
+	vector<exception_ptr> exceptions = parallelFor(4, 4, [&](size_t _index) {
+		innerExceptions[_index] = parallelFor(8, 4, [&](size_t) { ++calls; });
+	});
+	BOOST_CHECK_EQUAL(calls.load(), 32u);
+	for (size_t i = 0; i < exceptions.size(); ++i)
+	{
+		BOOST_CHECK(!exceptions[i]);
+		BOOST_CHECK_EQUAL(innerExceptions[i].size(), 8);
+		for (exception_ptr const& exception: innerExceptions[i])
+			BOOST_CHECK(!exception);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(thread_pool_reuses_threads)
+{
+	ThreadPool pool;
+	set<thread::id> threadIDs;
+	size_t const rounds = 50;
+	for (size_t i = 0; i < rounds; ++i)
+	{
+		promise<thread::id> done;
+		BOOST_REQUIRE(pool.submit([&]() { done.set_value(this_thread::get_id()); }));
+		threadIDs.insert(done.get_future().get());
+	}
+	BOOST_CHECK_EQUAL(threadIDs.size(), pool.threadCount());
+	BOOST_CHECK_LT(pool.threadCount(), rounds);
+}
+
+BOOST_AUTO_TEST_CASE(thread_pool_runs_pending_tasks_on_destruction)
+{
+	atomic<unsigned> calls{0};
+	{
+		ThreadPool pool;
+		for (size_t i = 0; i < 10; ++i)
+			BOOST_REQUIRE(pool.submit([&]() { ++calls; }));
+	}
+	BOOST_CHECK_EQUAL(calls.load(), 10u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -208,6 +208,44 @@ BOOST_AUTO_TEST_CASE(invalid_param_rendered)
 	BOOST_CHECK_EQUAL(m.render(), templ);
 }
 
+BOOST_AUTO_TEST_CASE(unclosed_elements_rendered)
+{
+	string templ = "<#l><a></m><?c><b><!c>x";
+	string result = Whiskers(templ)("a", "A")("b", "B").render();
+	BOOST_CHECK_EQUAL(result, "<#l>A</m><?c>B<!c>x");
+}
+
+BOOST_AUTO_TEST_CASE(nested_conditions_and_list)
+{
+	string templ = "<?c>[<#l><?d><x><!d>-</d></l>]<!c><?+a>(<a>)</+a></c>";
+	vector<map<string, string>> list(2);
+	list[0]["x"] = "1";
+	list[1]["x"] = "2";
+	BOOST_CHECK_EQUAL(Whiskers(templ)("a", "A")("c", true)("d", true)("l", list).render(), "[12]");
+	BOOST_CHECK_EQUAL(Whiskers(templ)("a", "A")("c", true)("d", false)("l", list).render(), "[--]");
+	BOOST_CHECK_EQUAL(Whiskers(templ)("a", "A")("c", false)("d", true)("l", list).render(), "(A)");
+	BOOST_CHECK_EQUAL(Whiskers(templ)("a", "")("c", false)("d", true)("l", list).render(), "");
+}
+
+BOOST_AUTO_TEST_CASE(list_in_list_unavailable)
+{
+	string templ = "<#l><#m>x</m></l>";
+	Whiskers m(templ);
+	m("l", vector<Whiskers::StringMap>(1));
+	m("m", vector<Whiskers::StringMap>(1));
+	BOOST_CHECK_THROW(m.render(), WhiskersError);
+}
+
+BOOST_AUTO_TEST_CASE(same_template_rendered_repeatedly)
+{
+	string templ = "<a><?c>+<!c>-</c>";
+	for (size_t i = 0; i < 3; ++i)
+	{
+		BOOST_CHECK_EQUAL(Whiskers(templ)("a", to_string(i))("c", true).render(), to_string(i) + "+");
+		BOOST_CHECK_EQUAL(Whiskers(templ)("a", to_string(i))("c", false).render(), to_string(i) + "-");
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -0,0 +1,97 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for running the optimiser suite on several threads.
+ */
+
+#include <test/Common.h>
+
+#include <libyul/AssemblyStack.h>
+
+#include <libsolidity/interface/OptimiserSettings.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace solidity::frontend;
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+string optimise(string const& _source, size_t _parallelism)
+{
+	AssemblyStack stack(
+		solidity::test::CommonOptions::get().evmVersion(),
+		AssemblyStack::Language::StrictAssembly,
+		OptimiserSettings::full()
+	);
+	stack.setOptimiserParallelism(_parallelism);
+	BOOST_REQUIRE(stack.parseAndAnalyze("", _source));
+	stack.optimize();
+	return stack.print();
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulOptimiserSuite)
+
+BOOST_AUTO_TEST_CASE(parallel_result_independent_of_threads)
+{
+	string source = R"({
+		let a := calldataload(0)
+		sstore(0, f(a, 2))
+		sstore(1, g(a))
+		sstore(2, h(calldataload(32)))
+		function f(x, y) -> r {
+			for { let i := 0 } lt(i, y) { i := add(i, 1) } {
+				r := add(r, mul(x, i))
+				if gt(r, 100) { break }
+			}
+		}
+		function g(x) -> r {
+			let t := add(x, 1)
+			t := mul(t, t)
+			switch and(t, 3)
+			case 0 { r := f(t, 3) }
+			case 1 { r := sub(t, 1) }
+			default { r := 7 }
+		}
+		function h(x) -> r {
+			let i := 0
+			for {} 1 {} {
+				if iszero(lt(i, x)) { break }
+				r := xor(r, g(i))
+				i := add(i, 1)
+			}
+		}
+	})";
+
+	string serial = optimise(source, 1);
+	for (size_t parallelism: vector<size_t>{2, 4})
+		BOOST_CHECK_EQUAL(optimise(source, parallelism), serial);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
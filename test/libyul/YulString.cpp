@@ -0,0 +1,92 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the YulString repository.
+ */
+
+#include <libyul/YulString.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <thread>
+
+using namespace std;
+
+namespace solidity::yul::test
+{
+
+BOOST_AUTO_TEST_SUITE(YulStringTest)
+
+BOOST_AUTO_TEST_CASE(interning)
+{
+	BOOST_CHECK(YulString{}.empty());
+	BOOST_CHECK(YulString{""} == YulString{});
+
+	vector<YulString> strings;
+	for (size_t i = 0; i < 1000; ++i)
+		strings.emplace_back("interning_" + to_string(i));
+	for (size_t i = 0; i < strings.size(); ++i)
+	{
+		YulString again{"interning_" + to_string(i)};
+		BOOST_CHECK(again == strings[i]);
+		BOOST_CHECK(!again.empty());
+		BOOST_CHECK_EQUAL(again.str(), "interning_" + to_string(i));
+		BOOST_CHECK_EQUAL(again.hash(), YulStringRepository::hash(again.str()));
+	}
+	BOOST_CHECK(strings[0] != strings[1]);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_interning)
+{
+	size_t const numThreads = 4;
+	size_t const numStrings = 2000;
+	vector<vector<YulString>> results(numThreads);
+	vector<thread> threads;
+	for (size_t t = 0; t < numThreads; ++t)
+		threads.emplace_back([&, t]() {
+			for (size_t i = 0; i < numStrings; ++i)
+				results[t].emplace_back("concurrent_" + to_string((i + t * 500) % numStrings));
+		});
+	for (thread& t: threads)
+		t.join();
+
+	for (size_t t = 0; t < numThreads; ++t)
+		for (size_t i = 0; i < numStrings; ++i)
+		{
+			YulString const& s = results[t][i];
+			BOOST_CHECK_EQUAL(s.str(), "concurrent_" + to_string((i + t * 500) % numStrings));
+			BOOST_CHECK(s == results[0][(i + t * 500) % numStrings]);
+		}
+}
+
+BOOST_AUTO_TEST_CASE(reset_deferred_by_scope)
+{
+	{
+		YulStringRepository::Scope scope;
+		YulString s{"reset_deferred_by_scope"};
+		YulStringRepository::reset();
+		BOOST_CHECK_EQUAL(s.str(), "reset_deferred_by_scope");
+		BOOST_CHECK(YulString{"reset_deferred_by_scope"} == s);
+	}
+	BOOST_CHECK(YulString{}.empty());
+	BOOST_CHECK_EQUAL(YulString{"after_reset"}.str(), "after_reset");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
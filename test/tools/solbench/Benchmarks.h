@@ -0,0 +1,42 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Benchmarks of solbench. Every benchmark is a subcommand that parses its own options from the
+ * arguments following the name of the subcommand (which is passed as the first argument) and
+ * returns the exit code.
+ */
+
+#pragma once
+
+namespace solidity::test::solbench
+{
+
+/// Compiles projects under several settings and reports the time and memory per phase.
+int compile(int argc, char** argv);
+/// Splits sources into tokens.
+int scanner(int argc, char** argv);
+/// Hashes and interns the identifiers of generated IR.
+int yulString(int argc, char** argv);
+/// Renders the templates of the ABI coding and utility functions.
+int whiskers(int argc, char** argv);
+/// Generates the IR of a contract with a large ABI.
+int irGeneration(int argc, char** argv);
+/// Queries the values of types that are computed on first use.
+int typeQueries(int argc, char** argv);
+
+}
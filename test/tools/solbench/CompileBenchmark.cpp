@@ -0,0 +1,346 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Benchmark for the compiler throughput. Compiles a corpus of projects under several settings
+ * and reports the time and the peak memory usage of every compilation phase as JSON. The time
+ * of the compilation is further split into code generation, IR generation, optimization and
+ * assembly.
+ */
+
+#include <test/tools/solbench/Benchmarks.h>
+
+#include <libsolidity/interface/CompilerStack.h>
+#include <libsolidity/interface/OptimiserSettings.h>
+#include <libsolidity/interface/Version.h>
+
+#include <liblangutil/SourceReferenceFormatter.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/JSON.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::test;
+using namespace solidity::frontend;
+using namespace solidity::langutil;
+using namespace solidity::util;
+
+namespace po = boost::program_options;
+namespace fs = boost::filesystem;
+
+namespace
+{
+
+struct Project
+{
+	string name;
+	StringMap sources;
+};
+
+struct Configuration
+{
+	bool viaIR = false;
+	bool optimize = false;
+	unsigned runs = 200;
+
+	Json::Value toJson() const
+	{
+		Json::Value result{Json::objectValue};
+		result["pipeline"] = viaIR ? "via-ir" : "legacy";
+		result["optimize"] = optimize;
+		if (optimize)
+			result["runs"] = runs;
+		return result;
+	}
+};
+
+/// Resets the peak resident set size of the process to the current one, so that peakRSS()
+/// only reports the peak of what follows. Only supported on Linux.
+/// @returns false if the peak could not be reset.
+bool resetPeakRSS()
+{
+#if defined(__linux__)
+	ofstream clearRefs("/proc/self/clear_refs");
+	clearRefs << "5";
+	return static_cast<bool>(clearRefs.flush());
+#else
+	return false;
+#endif
+}
+
+/// @returns the peak resident set size of the process since the last successful call to
+/// resetPeakRSS() in kilobytes.
+optional<uint64_t> peakRSS()
+{
+	ifstream status("/proc/self/status");
+	string line;
+	while (getline(status, line))
+		if (line.compare(0, 6, "VmHWM:") == 0)
+			return stoull(line.substr(6));
+	return nullopt;
+}
+
+/// Steps of the time report of the compilation by the part of the compilation they belong to.
+map<string, string> const compilationSteps{
+	{"codeGeneration", "codeGeneration"},
+	{"evmCodeGenerationFromIR", "codeGeneration"},
+	{"irGeneration", "irGeneration"},
+	{"optimization", "optimization"},
+	{"irOptimization", "optimization"},
+	{"evmDialectOptimization", "optimization"},
+	{"assembly", "assembly"}
+};
+
+/// @returns the time in milliseconds spent in every part of the compilation, summed up over
+/// all contracts. If contracts are compiled concurrently, the sum can exceed the wall time.
+Json::Value compilationPartTimes(Json::Value const& _timeReport)
+{
+	Json::Value parts{Json::objectValue};
+	for (auto const& part: compilationSteps)
+		parts[part.second] = 0.0;
+	Json::Value const& contracts = _timeReport["compilation"]["contracts"];
+	for (string const& contract: contracts.getMemberNames())
+		for (string const& step: contracts[contract]["steps"].getMemberNames())
+			if (auto it = compilationSteps.find(step); it != compilationSteps.end())
+				parts[it->second] = parts[it->second].asDouble() + contracts[contract]["steps"][step].asDouble() / 1000;
+	return parts;
+}
+
+/// Loads all Solidity files below @a _path (or @a _path itself if it is a file) into a project.
+/// Source unit names are relative to @a _path, so that relative imports inside the project work.
+Project loadProject(fs::path const& _path)
+{
+	Project project;
+	project.name = _path.filename().string();
+	if (fs::is_directory(_path))
+	{
+		for (auto const& entry: fs::recursive_directory_iterator(_path))
+			if (fs::is_regular_file(entry.path()) && entry.path().extension() == ".sol")
+				project.sources[fs::relative(entry.path(), _path).generic_string()] =
+					readFileAsString(entry.path().string());
+	}
+	else
+		project.sources[_path.filename().string()] = readFileAsString(_path.string());
+	return project;
+}
+
+/// Compiles @a _project once and @returns the time and peak memory per phase,
+/// or null on compilation failure. Failures are part of the report, since not every
+/// project can be compiled with every pipeline.
+Json::Value compileOnce(Project const& _project, Configuration const& _configuration, size_t _parallelism)
+{
+	CompilerStack compiler;
+	compiler.setSources(_project.sources);
+	compiler.setViaIR(_configuration.viaIR);
+	compiler.setParallelism(_parallelism);
+	OptimiserSettings settings = _configuration.optimize ? OptimiserSettings::standard() : OptimiserSettings::minimal();
+	settings.expectedExecutionsPerDeployment = _configuration.runs;
+	compiler.setOptimiserSettings(settings);
+	compiler.enableTimeReport();
+
+	Json::Value phases{Json::objectValue};
+	auto runPhase = [&](string const& _name, auto _phase) {
+		bool const measureMemory = resetPeakRSS();
+		auto start = chrono::steady_clock::now();
+		bool success = _phase();
+		Json::Value& phase = phases[_name];
+		phase["time"] = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+		if (optional<uint64_t> rss = peakRSS(); rss && measureMemory)
+			phase["peakRSS"] = Json::UInt64(*rss);
+		return success;
+	};
+
+	bool success =
+		runPhase("parse", [&]() { return compiler.parse(); }) &&
+		runPhase("analyze", [&]() { return compiler.analyze(); }) &&
+		runPhase("compile", [&]() { return compiler.compile(); });
+	if (!success)
+	{
+		SourceReferenceFormatter formatter(cerr, true, false);
+		for (auto const& error: compiler.errors())
+			formatter.printErrorInformation(*error);
+		return Json::nullValue;
+	}
+	phases["compile"]["parts"] = compilationPartTimes(compiler.timeReport());
+	return phases;
+}
+
+/// Combines the phases of several repetitions, keeping the minimum time and the maximum memory.
+void combinePhases(Json::Value& _result, Json::Value const& _phases)
+{
+	if (_result.isNull())
+	{
+		_result = _phases;
+		return;
+	}
+	for (string const& name: _phases.getMemberNames())
+	{
+		Json::Value& phase = _result[name];
+		phase["time"] = min(phase["time"].asDouble(), _phases[name]["time"].asDouble());
+		if (_phases[name].isMember("peakRSS"))
+			phase["peakRSS"] = max(phase["peakRSS"].asUInt64(), _phases[name]["peakRSS"].asUInt64());
+		for (string const& part: _phases[name]["parts"].getMemberNames())
+			phase["parts"][part] = min(phase["parts"][part].asDouble(), _phases[name]["parts"][part].asDouble());
+	}
+}
+
+}
+
+int solbench::compile(int argc, char** argv)
+{
+	po::options_description options(
+		R"(solbench compile, benchmark for the compiler throughput.
+Usage: solbench compile [Options] <path>...
+Every path is a project: either a single Solidity file or a directory whose Solidity
+files are compiled together. Each project is compiled for every combination of the
+selected pipelines and optimiser settings, and the time and peak memory usage (on Linux)
+of every phase are reported as JSON. The time of the compilation phase is further split
+into code generation, IR generation, optimization and assembly.
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23);
+	options.add_options()
+		("help", "Show this help screen.")
+		("pipeline", po::value<string>()->default_value("both"), "Code generation pipeline: legacy, via-ir or both.")
+		("optimize", po::value<string>()->default_value("both"), "Optimiser: off, on or both.")
+		("runs", po::value<vector<unsigned>>()->multitoken(), "Values of --optimize-runs to use with the optimiser (default 200).")
+		("repetitions", po::value<size_t>()->default_value(1), "Number of compilations per configuration. The minimum time is reported.")
+		("parallelism", po::value<size_t>()->default_value(1), "Number of threads the compiler may use.")
+		("output", po::value<string>(), "Write the report to the given file instead of stdout.")
+		("input-path", po::value<vector<string>>(), "input path");
+	po::positional_options_description filesPositions;
+	filesPositions.add("input-path", -1);
+
+	po::variables_map arguments;
+	try
+	{
+		po::command_line_parser cmdLineParser(argc, argv);
+		cmdLineParser.options(options).positional(filesPositions);
+		po::store(cmdLineParser.run(), arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+
+	if (arguments.count("help") || !arguments.count("input-path"))
+	{
+		cout << options;
+		return 0;
+	}
+
+	string const pipeline = arguments["pipeline"].as<string>();
+	string const optimize = arguments["optimize"].as<string>();
+	if (
+		(pipeline != "legacy" && pipeline != "via-ir" && pipeline != "both") ||
+		(optimize != "off" && optimize != "on" && optimize != "both")
+	)
+	{
+		cerr << "Invalid value for --pipeline or --optimize." << endl;
+		return 1;
+	}
+	vector<unsigned> runs{200};
+	if (arguments.count("runs"))
+		runs = arguments["runs"].as<vector<unsigned>>();
+
+	vector<Configuration> configurations;
+	for (bool viaIR: {false, true})
+	{
+		if ((viaIR && pipeline == "legacy") || (!viaIR && pipeline == "via-ir"))
+			continue;
+		if (optimize != "on")
+			configurations.push_back({viaIR, false, 200});
+		if (optimize != "off")
+			for (unsigned runsValue: runs)
+				configurations.push_back({viaIR, true, runsValue});
+	}
+
+	vector<Project> projects;
+	for (string const& path: arguments["input-path"].as<vector<string>>())
+		try
+		{
+			projects.emplace_back(loadProject(path));
+		}
+		catch (fs::filesystem_error const& _exception)
+		{
+			cerr << _exception.what() << endl;
+			return 1;
+		}
+		catch (FileNotFound const&)
+		{
+			cerr << "File not found: " << path << endl;
+			return 1;
+		}
+
+	size_t const repetitions = max<size_t>(arguments["repetitions"].as<size_t>(), 1);
+	size_t const parallelism = arguments["parallelism"].as<size_t>();
+
+	Json::Value report{Json::objectValue};
+	report["version"] = VersionString;
+	report["repetitions"] = Json::UInt64(repetitions);
+	report["parallelism"] = Json::UInt64(parallelism);
+	report["results"] = Json::arrayValue;
+	for (Project const& project: projects)
+		for (Configuration const& configuration: configurations)
+		{
+			Json::Value result = configuration.toJson();
+			result["project"] = project.name;
+			result["sources"] = Json::UInt64(project.sources.size());
+			Json::Value phases;
+			for (size_t i = 0; i < repetitions && (i == 0 || !phases.isNull()); ++i)
+				combinePhases(phases, compileOnce(project, configuration, parallelism));
+			if (phases.isNull())
+			{
+				cerr << "Compilation of " << project.name << " failed." << endl;
+				result["error"] = "Compilation failed.";
+			}
+			else
+			{
+				double total = 0;
+				for (string const& name: phases.getMemberNames())
+					total += phases[name]["time"].asDouble();
+				result["phases"] = move(phases);
+				result["time"] = total;
+			}
+			report["results"].append(move(result));
+		}
+
+	if (arguments.count("output"))
+	{
+		ofstream output(arguments["output"].as<string>());
+		output << jsonPrettyPrint(report) << endl;
+	}
+	else
+		cout << jsonPrettyPrint(report) << endl;
+
+	return 0;
+}
@@ -0,0 +1,173 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Micro-benchmark for the IR generation of contracts with a large ABI. Generates a contract
+ * with nested structs and arrays in the signatures of its functions and events and measures
+ * the time the IR generator spends on it. Names of nested types are part of the names of
+ * most generated functions, so this is dominated by the ABI coding and utility functions.
+ */
+
+#include <test/tools/solbench/Benchmarks.h>
+
+#include <libsolidity/interface/CompilerStack.h>
+
+#include <liblangutil/SourceReferenceFormatter.h>
+
+#include <json/json.h>
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <string>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::test;
+using namespace solidity::frontend;
+using namespace solidity::langutil;
+
+namespace po = boost::program_options;
+
+namespace
+{
+
+/// @returns a contract with @a _depth levels of nested structs and @a _functions functions
+/// for every level that encode and decode arrays of these structs.
+string generateSource(size_t _depth, size_t _functions)
+{
+	string source = "// SPDX-License-Identifier: GPL-3.0\npragma solidity >=0.0;\npragma abicoder v2;\ncontract C {\n";
+	source += "\tstruct S0 { uint256 a; bytes b; uint8[3] c; address[] d; }\n";
+	for (size_t level = 1; level < _depth; ++level)
+	{
+		string const inner = "S" + to_string(level - 1);
+		source +=
+			"\tstruct S" + to_string(level) + " { " + inner + " a; " + inner + "[] b; " +
+			inner + "[2] c; string d; }\n";
+	}
+	for (size_t level = 0; level < _depth; ++level)
+	{
+		string const type = "S" + to_string(level);
+		source += "\tevent E" + to_string(level) + "(" + type + "[] x, " + type + " y);\n";
+		for (size_t i = 0; i < _functions; ++i)
+		{
+			string const suffix = to_string(level) + "_" + to_string(i);
+			source +=
+				"\tfunction f" + suffix + "(" + type + "[] memory x, " + type + " memory y, uint" +
+				to_string(8 * (i % 32 + 1)) + " z) public returns (" + type + "[] memory, bytes memory) {\n"
+				"\t\temit E" + to_string(level) + "(x, y);\n"
+				"\t\tbytes memory data = abi.encode(x, y, z);\n"
+				"\t\t(" + type + "[] memory u, , ) = abi.decode(data, (" + type + "[], " + type + ", uint" +
+				to_string(8 * (i % 32 + 1)) + "));\n"
+				"\t\treturn (u, abi.encodePacked(z));\n"
+				"\t}\n";
+		}
+	}
+	return source + "}\n";
+}
+
+/// Compiles @a _source to IR and @returns the time spent in the IR generator in milliseconds,
+/// or a negative value on failure.
+double measureIRGeneration(string const& _source)
+{
+	CompilerStack compiler;
+	compiler.setSources({{"benchmark.sol", _source}});
+	compiler.enableIRGeneration();
+	compiler.enableEvmBytecodeGeneration(false);
+	compiler.enableTimeReport();
+	if (!compiler.compile())
+	{
+		SourceReferenceFormatter formatter(cerr, true, false);
+		for (auto const& error: compiler.errors())
+			formatter.printErrorInformation(*error);
+		return -1;
+	}
+
+	double time = 0;
+	Json::Value const contracts = compiler.timeReport()["compilation"]["contracts"];
+	for (string const& contract: contracts.getMemberNames())
+		time += contracts[contract]["steps"]["irGeneration"].asDouble() / 1000;
+	return time;
+}
+
+}
+
+int solbench::irGeneration(int argc, char** argv)
+{
+	po::options_description options(
+		R"(solbench irgeneration, micro-benchmark for the IR generation of ABI-heavy contracts.
+Usage: solbench irgeneration [Options]
+Generates a contract with nested structs and arrays in its external interface, compiles
+it to IR repeatedly and reports the minimum time spent in the IR generator.
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23);
+	options.add_options()
+		("help", "Show this help screen.")
+		("depth", po::value<size_t>()->default_value(4), "Nesting depth of the structs.")
+		("functions", po::value<size_t>()->default_value(8), "Number of functions per nesting level.")
+		("repetitions", po::value<size_t>()->default_value(5), "Number of compilations.")
+		("print-source", "Print the generated contract and exit.");
+
+	po::variables_map arguments;
+	try
+	{
+		po::store(po::parse_command_line(argc, argv, options), arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+
+	if (arguments.count("help"))
+	{
+		cout << options;
+		return 0;
+	}
+
+	string const source = generateSource(
+		max<size_t>(arguments["depth"].as<size_t>(), 1),
+		arguments["functions"].as<size_t>()
+	);
+	if (arguments.count("print-source"))
+	{
+		cout << source;
+		return 0;
+	}
+
+	size_t const repetitions = max<size_t>(arguments["repetitions"].as<size_t>(), 1);
+	double minTime = numeric_limits<double>::max();
+	for (size_t i = 0; i < repetitions; ++i)
+	{
+		double time = measureIRGeneration(source);
+		if (time < 0)
+		{
+			cerr << "Compilation failed." << endl;
+			return 1;
+		}
+		minTime = min(minTime, time);
+	}
+
+	cout << "Source: " << source.size() << " bytes" << endl;
+	cout << "IR generation: " << minTime << " ms (minimum of " << repetitions << " repetitions)" << endl;
+
+	return 0;
+}
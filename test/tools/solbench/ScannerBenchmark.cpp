@@ -0,0 +1,169 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Micro-benchmark for the scanner. Splits the given files (e.g. flattened contracts) or a
+ * generated contract with extensive NatSpec documentation into tokens over and over again.
+ */
+
+#include <test/tools/solbench/Benchmarks.h>
+
+#include <liblangutil/Scanner.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/Exceptions.h>
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::test;
+using namespace solidity::langutil;
+
+namespace po = boost::program_options;
+
+namespace
+{
+
+/// @returns a contract with @a _functions documented functions, formatted like flattened
+/// sources of large projects usually are.
+string generateSource(size_t _functions)
+{
+	string source =
+		"// SPDX-License-Identifier: GPL-3.0\n"
+		"pragma solidity >=0.0;\n\n"
+		"/**\n"
+		" * @title Benchmark\n"
+		" * @dev This contract is generated to measure the time spent in the scanner. Its comments are\n"
+		" * longer than its code, as they are in many contracts of large projects.\n"
+		" */\n"
+		"contract Benchmark {\n";
+	for (size_t i = 0; i < _functions; ++i)
+	{
+		string const suffix = to_string(i);
+		source +=
+			"    /// @notice Transfers `amount` tokens from the caller to `recipient` and emits an event.\n"
+			"    /// @dev Reverts if the balance of the caller is insufficient; see the documentation of\n"
+			"    /// the token standard for the exact requirements.\n"
+			"    /// @param recipient The address of the account receiving the tokens.\n"
+			"    /// @param amount The number of tokens to transfer.\n"
+			"    /// @return success Whether the transfer succeeded.\n"
+			"    function transferTokensToRecipient" + suffix + "(address recipient, uint256 amount) public returns (bool success) {\n"
+			"        // Checks the balance before the state is modified.\n"
+			"        require(balanceOfAccountHolder[msg.sender] >= amount, \"insufficient balance\");\n"
+			"        /* The subtraction cannot overflow because of the check above. */\n"
+			"        balanceOfAccountHolder[msg.sender] -= amount;\n"
+			"        balanceOfAccountHolder[recipient] += amount;\n"
+			"        emit TransferredTokens(msg.sender, recipient, amount);\n"
+			"        return true;\n"
+			"    }\n\n";
+	}
+	return source + "}\n";
+}
+
+/// Splits @a _source into tokens and @returns the number of tokens.
+size_t scan(CharStream const& _source)
+{
+	Scanner scanner(_source);
+	size_t tokens = 0;
+	for (; scanner.currentToken() != Token::EOS; scanner.next())
+		++tokens;
+	return tokens;
+}
+
+}
+
+int solbench::scanner(int argc, char** argv)
+{
+	po::options_description options(
+		R"(solbench scanner, micro-benchmark for the scanner.
+Usage: solbench scanner [Options] [file ...]
+Splits the given files, or a generated contract with extensive documentation
+if no file is given, into tokens repeatedly and measures the time spent.
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23);
+	options.add_options()
+		("help", "Show this help screen.")
+		("functions", po::value<size_t>()->default_value(5000), "Number of functions of the generated contract.")
+		("repetitions", po::value<size_t>()->default_value(20), "Number of times all sources are scanned.");
+	po::options_description allOptions = options;
+	allOptions.add_options()("input-file", po::value<vector<string>>(), "input file");
+	po::positional_options_description filesPositions;
+	filesPositions.add("input-file", -1);
+
+	po::variables_map arguments;
+	try
+	{
+		po::command_line_parser cmdLineParser(argc, argv);
+		cmdLineParser.options(allOptions).positional(filesPositions);
+		po::store(cmdLineParser.run(), arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+
+	if (arguments.count("help"))
+	{
+		cout << options;
+		return 0;
+	}
+
+	vector<CharStream> sources;
+	if (arguments.count("input-file"))
+		for (string const& file: arguments["input-file"].as<vector<string>>())
+			try
+			{
+				sources.emplace_back(util::readFileAsString(file), file);
+			}
+			catch (util::FileNotFound const&)
+			{
+				cerr << "File not found: " << file << endl;
+				return 1;
+			}
+	else
+		sources.emplace_back(generateSource(arguments["functions"].as<size_t>()), "benchmark.sol");
+
+	size_t bytes = 0;
+	for (CharStream const& source: sources)
+		bytes += source.source().size();
+
+	size_t const repetitions = max<size_t>(arguments["repetitions"].as<size_t>(), 1);
+	size_t tokens = 0;
+	auto start = chrono::steady_clock::now();
+	for (size_t i = 0; i < repetitions; ++i)
+	{
+		tokens = 0;
+		for (CharStream const& source: sources)
+			tokens += scan(source);
+	}
+	double time = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() / double(repetitions);
+
+	cout << "Sources: " << bytes << " bytes, " << tokens << " tokens" << endl;
+	cout << "Time: " << time << " ms per repetition (" << double(bytes) / 1000 / time << " MB/s)" << endl;
+
+	return 0;
+}
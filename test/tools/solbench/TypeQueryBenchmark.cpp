@@ -0,0 +1,190 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Micro-benchmark for the values of types that are computed on first use. Measures repeated
+ * queries of the types of all expressions in the given Solidity sources, outside of and inside
+ * of a concurrent section.
+ */
+
+#include <test/tools/solbench/Benchmarks.h>
+
+#include <libsolidity/ast/ASTVisitor.h>
+#include <libsolidity/ast/TypeProvider.h>
+#include <libsolidity/interface/CompilerStack.h>
+
+#include <liblangutil/SourceReferenceFormatter.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/Exceptions.h>
+#include <libsolutil/Parallel.h>
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::test;
+using namespace solidity::util;
+using namespace solidity::langutil;
+using namespace solidity::frontend;
+
+namespace po = boost::program_options;
+
+namespace
+{
+
+class ExpressionTypeCollector: public ASTConstVisitor
+{
+public:
+	vector<Type const*> types;
+
+private:
+	bool visitNode(ASTNode const& _node) override
+	{
+		if (auto const* expression = dynamic_cast<Expression const*>(&_node))
+			if (expression->annotation().type)
+				types.push_back(expression->annotation().type);
+		return true;
+	}
+};
+
+/// Queries values of @a _types that are computed on first use.
+/// @returns the number of queries.
+size_t queryTypes(vector<Type const*> const& _types, size_t& _checksum)
+{
+	for (Type const* type: _types)
+	{
+		_checksum += type->richIdentifier().size();
+		_checksum += type->toString(true).size();
+		_checksum += type->sizeOnStack();
+		MemberList const& members = type->members(nullptr);
+		_checksum += static_cast<size_t>(members.end() - members.begin());
+		_checksum += reinterpret_cast<size_t>(TypeProvider::tuple({type}));
+		_checksum += reinterpret_cast<size_t>(TypeProvider::bytesMemory());
+	}
+	return 6 * _types.size();
+}
+
+}
+
+int solbench::typeQueries(int argc, char** argv)
+{
+	po::options_description options(
+		R"(solbench types, micro-benchmark for the values of types computed on first use.
+Usage: solbench types [Options] <file>...
+Analyses the given Solidity files and repeatedly queries names, stack sizes, members and
+shared instances of the types of all expressions.
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23);
+	options.add_options()
+		("help", "Show this help screen.")
+		("repetitions", po::value<size_t>()->default_value(200), "Number of passes over all types.")
+		("threads", po::value<size_t>()->default_value(2), "Number of threads querying concurrently.")
+		("input-file", po::value<vector<string>>(), "input file");
+	po::positional_options_description filesPositions;
+	filesPositions.add("input-file", -1);
+
+	po::variables_map arguments;
+	try
+	{
+		po::command_line_parser cmdLineParser(argc, argv);
+		cmdLineParser.options(options).positional(filesPositions);
+		po::store(cmdLineParser.run(), arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+
+	if (arguments.count("help") || !arguments.count("input-file"))
+	{
+		cout << options;
+		return 0;
+	}
+
+	map<string, string> sources;
+	for (string const& path: arguments["input-file"].as<vector<string>>())
+		try
+		{
+			sources[path] = readFileAsString(path);
+		}
+		catch (FileNotFound const&)
+		{
+			cerr << "File not found: " << path << endl;
+			return 1;
+		}
+
+	CompilerStack compiler;
+	compiler.setSources(sources);
+	if (!compiler.parseAndAnalyze(CompilerStack::State::AnalysisPerformed))
+	{
+		SourceReferenceFormatter formatter(cerr, true, false);
+		for (auto const& error: compiler.errors())
+			formatter.printErrorInformation(*error);
+		return 1;
+	}
+
+	ExpressionTypeCollector collector;
+	for (string const& sourceName: compiler.sourceNames())
+		compiler.ast(sourceName).accept(collector);
+
+	size_t const repetitions = arguments["repetitions"].as<size_t>();
+	size_t const threads = max<size_t>(arguments["threads"].as<size_t>(), 1);
+	size_t checksum = 0;
+	// The first pass computes the values, all later ones only read them.
+	size_t queries = queryTypes(collector.types, checksum);
+	cout << "Expression types: " << collector.types.size() << endl;
+
+	auto measureNanoseconds = [&](size_t _threads) {
+		auto start = chrono::steady_clock::now();
+		vector<size_t> checksums(_threads, 0);
+		util::parallelFor(_threads, _threads, [&](size_t _thread) {
+			for (size_t i = 0; i < repetitions; ++i)
+				queryTypes(collector.types, checksums[_thread]);
+		});
+		for (size_t threadChecksum: checksums)
+			checksum += threadChecksum;
+		double total = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+		return total / static_cast<double>(queries * repetitions * _threads);
+	};
+
+	double serialTime = measureNanoseconds(1);
+	double sectionTime = 0;
+	double concurrentTime = 0;
+	{
+		Type::ConcurrentSection section;
+		sectionTime = measureNanoseconds(1);
+		concurrentTime = measureNanoseconds(threads);
+	}
+
+	cout << "Serial:                       " << serialTime << " ns per query" << endl;
+	cout << "In concurrent section:        " << sectionTime << " ns per query" << endl;
+	cout << "In concurrent section, " << threads << " threads: " << concurrentTime << " ns per query" << endl;
+	cout << "(checksum " << checksum << ")" << endl;
+
+	return 0;
+}
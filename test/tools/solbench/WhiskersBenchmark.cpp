@@ -0,0 +1,149 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Micro-benchmark for the Whiskers templates. Generates the ABI coding and utility
+ * functions the IR code generator uses for a fixed set of types over and over again,
+ * which renders the templates of ABIFunctions and YulUtilFunctions.
+ */
+
+#include <test/tools/solbench/Benchmarks.h>
+
+#include <libsolidity/ast/TypeProvider.h>
+#include <libsolidity/codegen/ABIFunctions.h>
+#include <libsolidity/codegen/MultiUseYulFunctionCollector.h>
+#include <libsolidity/codegen/YulUtilFunctions.h>
+
+#include <liblangutil/EVMVersion.h>
+
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::test;
+using namespace solidity::frontend;
+
+namespace po = boost::program_options;
+
+namespace
+{
+
+/// Requests the functions for all types from a new collector and @returns the size of the code.
+size_t generateFunctions(vector<IntegerType const*> const& _integerTypes, TypePointers const& _types)
+{
+	langutil::EVMVersion evmVersion;
+	MultiUseYulFunctionCollector collector;
+	ABIFunctions abiFunctions(evmVersion, RevertStrings::Default, collector);
+	YulUtilFunctions utils(evmVersion, RevertStrings::Default, collector);
+
+	abiFunctions.tupleEncoder(_types, _types);
+	abiFunctions.tupleEncoderPacked(_types, _types);
+	abiFunctions.tupleDecoder(_types);
+	abiFunctions.tupleDecoder(_types, true);
+	for (Type const* type: _types)
+	{
+		utils.cleanupFunction(*type);
+		if (auto arrayType = dynamic_cast<ArrayType const*>(type))
+			utils.arrayLengthFunction(*arrayType);
+	}
+	for (IntegerType const* type: _integerTypes)
+	{
+		utils.overflowCheckedIntAddFunction(*type);
+		utils.overflowCheckedIntMulFunction(*type);
+		utils.overflowCheckedIntSubFunction(*type);
+		utils.conversionFunction(*type, *TypeProvider::uint256());
+	}
+
+	ArrayType const* storageArray = TypeProvider::array(DataLocation::Storage, TypeProvider::uint256());
+	utils.resizeArrayFunction(*storageArray);
+	utils.storageArrayIndexAccessFunction(*storageArray);
+	utils.memoryArrayIndexAccessFunction(*TypeProvider::array(DataLocation::Memory, TypeProvider::uint256()));
+
+	return collector.requestedFunctions().size();
+}
+
+}
+
+int solbench::whiskers(int argc, char** argv)
+{
+	po::options_description options(
+		R"(solbench whiskers, micro-benchmark for the Whiskers templates.
+Usage: solbench whiskers [Options]
+Generates the ABI coding and utility functions for a fixed set of types repeatedly
+and measures the time spent.
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23);
+	options.add_options()
+		("help", "Show this help screen.")
+		("repetitions", po::value<size_t>()->default_value(200), "Number of times all functions are generated.");
+
+	po::variables_map arguments;
+	try
+	{
+		po::store(po::parse_command_line(argc, argv, options), arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+
+	if (arguments.count("help"))
+	{
+		cout << options;
+		return 0;
+	}
+
+	vector<IntegerType const*> integerTypes{
+		TypeProvider::uint(8),
+		TypeProvider::uint(64),
+		TypeProvider::uint256(),
+		TypeProvider::integer(32, IntegerType::Modifier::Signed),
+		TypeProvider::integer(256, IntegerType::Modifier::Signed)
+	};
+	TypePointers types{
+		TypeProvider::boolean(),
+		TypeProvider::address(),
+		TypeProvider::fixedBytes(4),
+		TypeProvider::fixedBytes(32),
+		TypeProvider::bytesMemory(),
+		TypeProvider::stringMemory(),
+		TypeProvider::array(DataLocation::Memory, TypeProvider::uint256()),
+		TypeProvider::array(DataLocation::Memory, TypeProvider::address(), 3),
+		TypeProvider::array(DataLocation::Memory, TypeProvider::bytesMemory())
+	};
+	types.insert(types.end(), integerTypes.begin(), integerTypes.end());
+
+	size_t const repetitions = arguments["repetitions"].as<size_t>();
+	size_t codeSize = 0;
+	auto start = chrono::steady_clock::now();
+	for (size_t i = 0; i < repetitions; ++i)
+		codeSize = generateFunctions(integerTypes, types);
+	double time = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+	cout << "Generated code: " << codeSize << " bytes per repetition" << endl;
+	cout << "Time: " << time << " ms (" << time / double(max<size_t>(repetitions, 1)) << " ms per repetition)" << endl;
+
+	return 0;
+}
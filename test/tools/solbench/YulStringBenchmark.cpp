@@ -0,0 +1,181 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Micro-benchmark for the YulString repository. Measures hashing and interning of the
+ * identifiers that occur in the IR generated for the given Solidity sources.
+ */
+
+#include <test/tools/solbench/Benchmarks.h>
+
+#include <libsolidity/interface/CompilerStack.h>
+
+#include <libyul/YulString.h>
+
+#include <liblangutil/Scanner.h>
+#include <liblangutil/SourceReferenceFormatter.h>
+
+#include <libsolutil/CommonData.h>
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/Exceptions.h>
+
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::test;
+using namespace solidity::util;
+using namespace solidity::langutil;
+using namespace solidity::yul;
+
+namespace po = boost::program_options;
+
+namespace
+{
+
+vector<string> collectIdentifiers(string const& _yulSource)
+{
+	vector<string> identifiers;
+	Scanner scanner(CharStream(_yulSource, ""));
+	scanner.setScannerMode(ScannerKind::Yul);
+	for (; scanner.currentToken() != Token::EOS; scanner.next())
+		if (scanner.currentToken() == Token::Identifier)
+			identifiers.emplace_back(scanner.currentLiteral());
+	return identifiers;
+}
+
+template <typename Function>
+double measureMilliseconds(size_t _repetitions, Function const& _function)
+{
+	auto start = chrono::steady_clock::now();
+	for (size_t i = 0; i < _repetitions; ++i)
+		_function();
+	return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+}
+
+int solbench::yulString(int argc, char** argv)
+{
+	po::options_description options(
+		R"(solbench yulstring, micro-benchmark for the YulString repository.
+Usage: solbench yulstring [Options] <file>...
+Generates the IR for the given Solidity files (or reads them as Yul with --yul) and
+measures hashing and interning of all identifiers in it.
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23);
+	options.add_options()
+		("help", "Show this help screen.")
+		("yul", "Treat the input files as Yul instead of Solidity.")
+		("repetitions", po::value<size_t>()->default_value(20), "Number of passes over all identifiers.")
+		("input-file", po::value<vector<string>>(), "input file");
+	po::positional_options_description filesPositions;
+	filesPositions.add("input-file", -1);
+
+	po::variables_map arguments;
+	try
+	{
+		po::command_line_parser cmdLineParser(argc, argv);
+		cmdLineParser.options(options).positional(filesPositions);
+		po::store(cmdLineParser.run(), arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+
+	if (arguments.count("help") || !arguments.count("input-file"))
+	{
+		cout << options;
+		return 0;
+	}
+
+	map<string, string> sources;
+	for (string const& path: arguments["input-file"].as<vector<string>>())
+		try
+		{
+			sources[path] = readFileAsString(path);
+		}
+		catch (FileNotFound const&)
+		{
+			cerr << "File not found: " << path << endl;
+			return 1;
+		}
+
+	vector<string> identifiers;
+	if (arguments.count("yul"))
+		for (auto const& source: sources)
+			identifiers += collectIdentifiers(source.second);
+	else
+	{
+		frontend::CompilerStack compiler;
+		compiler.setSources(sources);
+		compiler.enableEvmBytecodeGeneration(false);
+		compiler.enableIRGeneration();
+		if (!compiler.compile())
+		{
+			SourceReferenceFormatter formatter(cerr, true, false);
+			for (auto const& error: compiler.errors())
+				formatter.printErrorInformation(*error);
+			return 1;
+		}
+		for (string const& contractName: compiler.contractNames())
+			identifiers += collectIdentifiers(compiler.yulIR(contractName));
+	}
+
+	size_t const repetitions = arguments["repetitions"].as<size_t>();
+	size_t totalLength = 0;
+	for (string const& identifier: identifiers)
+		totalLength += identifier.size();
+	cout << "Identifiers: " << identifiers.size() << " (" << totalLength << " bytes)" << endl;
+
+	uint64_t checksum = 0;
+	double orderingHashTime = measureMilliseconds(repetitions, [&]() {
+		for (string const& identifier: identifiers)
+			checksum ^= YulStringRepository::hash(identifier);
+	});
+	double lookupHashTime = measureMilliseconds(repetitions, [&]() {
+		for (string const& identifier: identifiers)
+			checksum ^= YulStringRepository::lookupHash(identifier);
+	});
+
+	YulStringRepository::reset();
+	double firstInterningTime = measureMilliseconds(1, [&]() {
+		for (string const& identifier: identifiers)
+			checksum ^= YulString(identifier).hash();
+	});
+	double interningTime = measureMilliseconds(repetitions, [&]() {
+		for (string const& identifier: identifiers)
+			checksum ^= YulString(identifier).hash();
+	});
+
+	cout << "Ordering hash (FNV):    " << orderingHashTime << " ms" << endl;
+	cout << "Lookup hash:            " << lookupHashTime << " ms" << endl;
+	cout << "Interning, first pass:  " << firstInterningTime << " ms" << endl;
+	cout << "Interning, later passes: " << interningTime << " ms" << endl;
+	cout << "(checksum " << checksum << ")" << endl;
+
+	return 0;
+}
@@ -0,0 +1,56 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Benchmarks for the compiler. The compiler throughput benchmark and micro-benchmarks for
+ * individual components are subcommands of a single tool.
+ */
+
+#include <test/tools/solbench/Benchmarks.h>
+
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace std;
+using namespace solidity::test;
+
+int main(int argc, char** argv)
+{
+	vector<tuple<string, int(*)(int, char**), string>> const benchmarks{
+		{"compile", solbench::compile, "Compiler throughput on projects under several settings."},
+		{"scanner", solbench::scanner, "Scanner on given or generated sources."},
+		{"yulstring", solbench::yulString, "Hashing and interning of Yul identifiers."},
+		{"whiskers", solbench::whiskers, "Rendering of the templates of the IR utility functions."},
+		{"irgeneration", solbench::irGeneration, "IR generation of contracts with a large ABI."},
+		{"types", solbench::typeQueries, "Queries of type names, stack sizes and members."}
+	};
+
+	if (argc >= 2)
+		for (auto const& [name, run, description]: benchmarks)
+			if (argv[1] == name)
+				return run(argc - 1, argv + 1);
+
+	cout << "solbench, benchmarks for the compiler." << endl;
+	cout << "Usage: solbench <benchmark> [Options]" << endl;
+	cout << "Run solbench <benchmark> --help for the options of a benchmark." << endl << endl;
+	cout << "Benchmarks:" << endl;
+	for (auto const& [name, run, description]: benchmarks)
+		cout << "  " << name << string(14 - name.size(), ' ') << description << endl;
+	return argc >= 2 && string(argv[1]) != "--help" ? 1 : 0;
+}